@@ -0,0 +1,375 @@
+#ifndef STDEXT_ARRAY_DEQUE_H
+#define STDEXT_ARRAY_DEQUE_H
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <initializer_list>
+#include "MemoryStats.h"
+#include "ArrayVector.h"
+
+namespace stdext {
+
+	/**
+	 * Class ArrayDeque, it's a circular buffer of elements of type @tparam T
+	 * with a compile-time maximum size of @tparam N elements. Like the
+	 * ArrayVector the elements are stored inside the ArrayDeque, so it won't
+	 * do any allocation at runtime, but the elements can be added and removed
+	 * in O(1) at both ends.
+	 */
+	template <typename T, std::size_t N>
+	class ArrayDeque
+	{
+	public:		// Nested types
+		/** Class ADIterator, it's the class used to iterate through the
+		 * elements of an ArrayDeque */
+		template <bool isConst>
+		class ADIterator
+		{
+		public:		// Nested types
+			template <bool isConst2>
+			friend class ADIterator;
+
+			using DequeType = std::conditional_t<isConst,
+				const ArrayDeque, ArrayDeque
+			>;
+
+			using size_type			= std::size_t;
+			using difference_type	= std::ptrdiff_t;
+			using value_type		= std::conditional_t<isConst, const T, T>;
+			using pointer			= value_type*;
+			using reference			= value_type&;
+			using iterator_category	= std::random_access_iterator_tag;
+
+		private:	// Attributes
+			/** A pointer to the ArrayDeque to iterate */
+			DequeType* mDeque;
+
+			/** The current position in the ArrayDeque, starting from its
+			 * front */
+			size_type mIndex;
+
+		public:		// Functions
+			/** Creates a new ADIterator
+			 *
+			 * @param	deque a pointer to the ArrayDeque to iterate
+			 * @param	index the inital index of the iterator */
+			ADIterator(DequeType* deque = nullptr, size_type index = 0) :
+				mDeque(deque), mIndex(index) {};
+
+			/** Implicit conversion operator between const ADIterator and non
+			 * const ADIterator
+			 *
+			 * @return	the new ADIterator with a different template const
+			 *			type */
+			operator ADIterator<!isConst>() const
+			{ return ADIterator<!isConst>(mDeque, mIndex); };
+
+			/** @return	the index of the Element that the iterator is pointing
+			 *			to, starting from the front of the ArrayDeque */
+			size_type getIndex() const { return mIndex; };
+
+			/** @return	a reference to the current Element that the iterator is
+			 *			pointing to */
+			reference operator*() const { return (*mDeque)[mIndex]; };
+
+			/** @return	a pointer to the current Element that the iterator is
+			 *			pointing to */
+			pointer operator->() const { return &(*mDeque)[mIndex]; };
+
+			/** @return	a reference to the Element located @param i positions
+			 *			after the current one */
+			reference operator[](difference_type i) const
+			{ return (*mDeque)[mIndex + i]; };
+
+			/** Compares the given ADIterators
+			 *
+			 * @param	it1 the first iterator to compare
+			 * @param	it2 the second iterator to compare
+			 * @return	true if both iterators are equal, false otherwise */
+			friend bool operator==(const ADIterator& it1, const ADIterator& it2)
+			{ return it1.mDeque == it2.mDeque && it1.mIndex == it2.mIndex; };
+
+			/** Compares the given ADIterators
+			 *
+			 * @param	it1 the first iterator to compare
+			 * @param	it2 the second iterator to compare
+			 * @return	true if both iterators are different, false otherwise */
+			friend bool operator!=(const ADIterator& it1, const ADIterator& it2)
+			{ return !(it1 == it2); };
+
+			/** Compares the given ADIterators
+			 *
+			 * @param	it1 the first iterator to compare
+			 * @param	it2 the second iterator to compare
+			 * @return	true if the first iterator is located before the
+			 *			second one, false otherwise */
+			friend bool operator<(const ADIterator& it1, const ADIterator& it2)
+			{ return it1.mIndex < it2.mIndex; };
+
+			/** @see operator< */
+			friend bool operator>(const ADIterator& it1, const ADIterator& it2)
+			{ return it2 < it1; };
+
+			/** @see operator< */
+			friend bool operator<=(const ADIterator& it1, const ADIterator& it2)
+			{ return !(it2 < it1); };
+
+			/** @see operator< */
+			friend bool operator>=(const ADIterator& it1, const ADIterator& it2)
+			{ return !(it1 < it2); };
+
+			/** @return	the number of Elements between the given ADIterators */
+			friend difference_type operator-(
+				const ADIterator& it1, const ADIterator& it2
+			) { return it1.mIndex - it2.mIndex; };
+
+			/** @return	a copy of the given ADIterator advanced @param n
+			 *			positions */
+			friend ADIterator operator+(ADIterator it, difference_type n)
+			{ return it += n; };
+
+			/** @return	a copy of the given ADIterator advanced @param n
+			 *			positions */
+			friend ADIterator operator+(difference_type n, ADIterator it)
+			{ return it += n; };
+
+			/** @return	a copy of the given ADIterator moved back @param n
+			 *			positions */
+			friend ADIterator operator-(ADIterator it, difference_type n)
+			{ return it -= n; };
+
+			/** Advances the iterator @param n positions
+			 *
+			 * @return	a reference to the current iterator */
+			ADIterator& operator+=(difference_type n)
+			{ mIndex += n; return *this; };
+
+			/** Moves back the iterator @param n positions
+			 *
+			 * @return	a reference to the current iterator */
+			ADIterator& operator-=(difference_type n)
+			{ mIndex -= n; return *this; };
+
+			/** Preincrement operator
+			 *
+			 * @return	a reference to the current iterator after its
+			 *			incrementation */
+			ADIterator& operator++() { ++mIndex; return *this; };
+
+			/** Postincrement operator
+			 *
+			 * @return	a copy of the current iterator with the previous value
+			 *			to the incrementation */
+			ADIterator operator++(int)
+			{ ADIterator ret(*this); ++mIndex; return ret; };
+
+			/** Predecrement operator
+			 *
+			 * @return	a reference to the current iterator after its
+			 *			decrementation */
+			ADIterator& operator--() { --mIndex; return *this; };
+
+			/** Postdecrement operator
+			 *
+			 * @return	a copy of the current iterator with the previous value
+			 *			to the decrementation */
+			ADIterator operator--(int)
+			{ ADIterator ret(*this); --mIndex; return ret; };
+		};
+
+		using size_type					= std::size_t;
+		using difference_type			= std::ptrdiff_t;
+		using value_type				= T;
+		using pointer					= T*;
+		using reference					= T&;
+		using iterator					= ADIterator<false>;
+		using const_iterator			= ADIterator<true>;
+		using reverse_iterator			= std::reverse_iterator<iterator>;
+		using const_reverse_iterator	= std::reverse_iterator<const_iterator>;
+
+	private:	// Attributes
+		/** The array of memory where the elements will be stored */
+		alignas(T) std::byte mData[N * sizeof(T)];
+
+		/** The position in @see mData of the first Element */
+		SmallestUnsigned<N> mFirst;
+
+		/** The number of Elements added to the ArrayDeque */
+		SmallestUnsigned<N> mNumElements;
+
+	public:		// Functions
+		/** Creates a new ArrayDeque */
+		ArrayDeque() : mFirst(0), mNumElements(0) {};
+		ArrayDeque(const ArrayDeque& other);
+		ArrayDeque(ArrayDeque&& other);
+
+		/** Creates a new ArrayDeque
+		 *
+		 * @param	list the initial elements stored inside the ArrayDeque
+		 * @note	it will be stored up to N elements */
+		ArrayDeque(std::initializer_list<T> list);
+
+		/** Class destructor */
+		~ArrayDeque() { clear(); };
+
+		/** Assignment operator */
+		ArrayDeque& operator=(const ArrayDeque& other);
+		ArrayDeque& operator=(ArrayDeque&& other);
+
+		/** Returns the Element i of the ArrayDeque
+		 *
+		 * @param	i the index of the Element, starting from the front of the
+		 *			ArrayDeque
+		 * @return	a reference to the Element */
+		T& operator[](size_type i) { return getData()[getPosition(i)]; };
+
+		/** Returns the Element i of the ArrayDeque
+		 *
+		 * @param	i the index of the Element, starting from the front of the
+		 *			ArrayDeque
+		 * @return	a reference to the Element */
+		const T& operator[](size_type i) const
+		{ return getData()[getPosition(i)]; };
+
+		/** @return	the initial iterator of the ArrayDeque */
+		iterator begin() { return iterator(this, 0); };
+
+		/** @return	the initial iterator of the ArrayDeque */
+		const_iterator begin() const { return const_iterator(this, 0); };
+
+		/** @return	the final iterator of the ArrayDeque */
+		iterator end() { return iterator(this, mNumElements); };
+
+		/** @return	the final iterator of the ArrayDeque */
+		const_iterator end() const
+		{ return const_iterator(this, mNumElements); };
+
+		/** @return	the initial reverse iterator of the ArrayDeque */
+		reverse_iterator rbegin() { return reverse_iterator(end()); };
+
+		/** @return	the initial reverse iterator of the ArrayDeque */
+		const_reverse_iterator rbegin() const
+		{ return const_reverse_iterator(end()); };
+
+		/** @return	the final reverse iterator of the ArrayDeque */
+		reverse_iterator rend() { return reverse_iterator(begin()); };
+
+		/** @return	the final reverse iterator of the ArrayDeque */
+		const_reverse_iterator rend() const
+		{ return const_reverse_iterator(begin()); };
+
+		/** @return	the number of elements in the ArrayDeque */
+		size_type size() const { return mNumElements; };
+
+		/** @return	the maximum number of elements that the ArrayDeque can
+		 *			store */
+		size_type capacity() const { return N; };
+
+		/** @return	true if the ArrayDeque has no elements, false otherwise */
+		bool empty() const { return (mNumElements == 0); };
+
+		/** @return	true if the ArrayDeque can't store more elements, false
+		 *			otherwise */
+		bool full() const { return (mNumElements == N); };
+
+		/** @return	the memory used by the ArrayDeque. It doesn't do any
+		 *			allocation, so the reserved bytes are the ones of its
+		 *			internal array */
+		MemoryStats getMemoryStats() const
+		{
+			MemoryStats stats;
+			stats.reservedBytes = N * sizeof(T);
+			stats.liveBytes = mNumElements * sizeof(T);
+			stats.numElements = mNumElements;
+			return stats;
+		};
+
+		/** @return	a reference to the first element in the ArrayDeque
+		 * @note	if the ArrayDeque is empty, it causes undefined behavior */
+		T& front() { return (*this)[0]; };
+
+		/** @return	a reference to the first element in the ArrayDeque
+		 * @note	if the ArrayDeque is empty, it causes undefined behavior */
+		const T& front() const { return (*this)[0]; };
+
+		/** @return	a reference to the last element in the ArrayDeque
+		 * @note	if the ArrayDeque is empty, it causes undefined behavior */
+		T& back() { return (*this)[mNumElements - 1]; };
+
+		/** @return	a reference to the last element in the ArrayDeque
+		 * @note	if the ArrayDeque is empty, it causes undefined behavior */
+		const T& back() const { return (*this)[mNumElements - 1]; };
+
+		/** Removes all the elements of the ArrayDeque */
+		void clear();
+
+		/** Appends the given element to the end of the ArrayDeque
+		 *
+		 * @param	element the element to append
+		 * @note	if the ArrayDeque is full, it causes undefined behavior */
+		void push_back(const T& element) { emplace_back(element); };
+
+		/** Appends a new element to the end of the ArrayDeque
+		 *
+		 * @param	args the arguments needed for calling the constructor of
+		 *			the new Element
+		 * @return	a reference to the new element
+		 * @note	if the ArrayDeque is full, it causes undefined behavior */
+		template <typename... Args>
+		T& emplace_back(Args&&... args);
+
+		/** Prepends the given element to the front of the ArrayDeque
+		 *
+		 * @param	element the element to prepend
+		 * @note	if the ArrayDeque is full, it causes undefined behavior */
+		void push_front(const T& element) { emplace_front(element); };
+
+		/** Prepends a new element to the front of the ArrayDeque
+		 *
+		 * @param	args the arguments needed for calling the constructor of
+		 *			the new Element
+		 * @return	a reference to the new element
+		 * @note	if the ArrayDeque is full, it causes undefined behavior */
+		template <typename... Args>
+		T& emplace_front(Args&&... args);
+
+		/** Removes the last element of the ArrayDeque
+		 * @note	if the ArrayDeque is empty, it causes undefined behavior */
+		void pop_back();
+
+		/** Removes the first element of the ArrayDeque
+		 * @note	if the ArrayDeque is empty, it causes undefined behavior */
+		void pop_front();
+	private:
+		/** @return	a pointer to the first position of @see mData */
+		T* getData() { return reinterpret_cast<T*>(mData); };
+
+		/** @return	a pointer to the first position of @see mData */
+		const T* getData() const { return reinterpret_cast<const T*>(mData); };
+
+		/** Returns the position in @see mData of the given Element
+		 *
+		 * @param	i the index of the Element, starting from the front of the
+		 *			ArrayDeque. It must be lower than N
+		 * @return	the position in @see mData */
+		size_type getPosition(size_type i) const
+		{
+			size_type position = mFirst + i;
+			return (position >= N)? position - N : position;
+		};
+
+		/** Copies the Elements of the given ArrayDeque to the start of the
+		 * current one, which must be empty
+		 *
+		 * @param	other the ArrayDeque to copy. If it's an rvalue, its
+		 *			Elements will be moved instead of copied */
+		template <typename D>
+		void copyElements(D&& other);
+	};
+
+}
+
+#include "ArrayDeque.hpp"
+
+#endif		// STDEXT_ARRAY_DEQUE_H
@@ -0,0 +1,145 @@
+#ifndef STDEXT_ARRAY_DEQUE_HPP
+#define STDEXT_ARRAY_DEQUE_HPP
+
+#include <memory>
+#include <cstring>
+#include <utility>
+#include <algorithm>
+
+namespace stdext {
+
+	template <typename T, std::size_t N>
+	ArrayDeque<T, N>::ArrayDeque(const ArrayDeque& other) : ArrayDeque()
+	{
+		copyElements(other);
+	}
+
+
+	template <typename T, std::size_t N>
+	ArrayDeque<T, N>::ArrayDeque(ArrayDeque&& other) : ArrayDeque()
+	{
+		copyElements(std::move(other));
+		other.clear();
+	}
+
+
+	template <typename T, std::size_t N>
+	ArrayDeque<T, N>::ArrayDeque(std::initializer_list<T> list) : ArrayDeque()
+	{
+		for (const T& member : list) {
+			if (full()) {
+				break;
+			}
+			push_back(member);
+		}
+	}
+
+
+	template <typename T, std::size_t N>
+	ArrayDeque<T, N>& ArrayDeque<T, N>::operator=(const ArrayDeque& other)
+	{
+		if (this != &other) {
+			clear();
+			copyElements(other);
+		}
+
+		return *this;
+	}
+
+
+	template <typename T, std::size_t N>
+	ArrayDeque<T, N>& ArrayDeque<T, N>::operator=(ArrayDeque&& other)
+	{
+		if (this != &other) {
+			clear();
+			copyElements(std::move(other));
+			other.clear();
+		}
+
+		return *this;
+	}
+
+
+	template <typename T, std::size_t N>
+	void ArrayDeque<T, N>::clear()
+	{
+		if constexpr (!std::is_trivially_destructible_v<T>) {
+			for (size_type i = 0; i < mNumElements; ++i) {
+				(*this)[i].~T();
+			}
+		}
+		mFirst = 0;
+		mNumElements = 0;
+	}
+
+
+	template <typename T, std::size_t N>
+	template <typename... Args>
+	T& ArrayDeque<T, N>::emplace_back(Args&&... args)
+	{
+		T* element = new (getData() + getPosition(mNumElements)) T(std::forward<Args>(args)...);
+		mNumElements++;
+
+		return *element;
+	}
+
+
+	template <typename T, std::size_t N>
+	template <typename... Args>
+	T& ArrayDeque<T, N>::emplace_front(Args&&... args)
+	{
+		size_type position = (mFirst == 0)? N - 1 : mFirst - 1;
+		T* element = new (getData() + position) T(std::forward<Args>(args)...);
+		mFirst = position;
+		mNumElements++;
+
+		return *element;
+	}
+
+
+	template <typename T, std::size_t N>
+	void ArrayDeque<T, N>::pop_back()
+	{
+		back().~T();
+		mNumElements--;
+	}
+
+
+	template <typename T, std::size_t N>
+	void ArrayDeque<T, N>::pop_front()
+	{
+		front().~T();
+		mFirst = getPosition(1);
+		mNumElements--;
+	}
+
+
+	template <typename T, std::size_t N>
+	template <typename D>
+	void ArrayDeque<T, N>::copyElements(D&& other)
+	{
+		if constexpr (std::is_trivially_copyable_v<T>) {
+			// The Elements are stored in at most two contiguous ranges
+			size_type numFirst = std::min<size_type>(other.mNumElements, N - other.mFirst);
+			size_type numSecond = other.mNumElements - numFirst;
+			std::memcpy(getData(), other.getData() + other.mFirst, numFirst * sizeof(T));
+			std::memcpy(getData() + numFirst, other.getData(), numSecond * sizeof(T));
+		}
+		else {
+			for (size_type i = 0; i < other.mNumElements; ++i) {
+				if constexpr (std::is_lvalue_reference_v<D>) {
+					new (getData() + i) T(other[i]);
+				}
+				else {
+					new (getData() + i) T(std::move(other[i]));
+				}
+			}
+		}
+
+		mFirst = 0;
+		mNumElements = other.mNumElements;
+	}
+
+}
+
+#endif		// STDEXT_ARRAY_DEQUE_HPP
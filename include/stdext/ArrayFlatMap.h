@@ -0,0 +1,166 @@
+#ifndef STDEXT_ARRAY_FLAT_MAP_H
+#define STDEXT_ARRAY_FLAT_MAP_H
+
+#include "ArrayFlatSet.h"
+
+namespace stdext {
+
+	/**
+	 * Class ArrayFlatMap, it's a map of keys of type @tparam K to values of
+	 * type @tparam V with a compile-time maximum size of @tparam N entries.
+	 * The keys are stored sorted with @tparam C inside an ArrayVector and the
+	 * values in the same positions in other ArrayVector, so the searchs only
+	 * touch the keys and the ArrayFlatMap won't do any allocation at runtime.
+	 *
+	 * @note	the comparison function @tparam C must be default
+	 *			constructible, it isn't stored inside the ArrayFlatMap
+	 */
+	template <typename K, typename V, std::size_t N, typename C = std::less<K>>
+	class ArrayFlatMap
+	{
+	public:		// Nested types
+		using size_type		= std::size_t;
+		using key_type		= K;
+		using mapped_type	= V;
+		using key_compare	= C;
+
+		/** The position returned when a key isn't found */
+		static constexpr size_type npos = static_cast<size_type>(-1);
+
+	private:	// Attributes
+		/** The sorted keys of the ArrayFlatMap */
+		ArrayVector<K, N> mKeys;
+
+		/** The values of the ArrayFlatMap, each one is located in the same
+		 * position than its key */
+		ArrayVector<V, N> mValues;
+
+	public:		// Functions
+		/** Creates a new ArrayFlatMap */
+		ArrayFlatMap() = default;
+
+		/** Creates a new ArrayFlatMap
+		 *
+		 * @param	list the initial entries of the ArrayFlatMap, they don't
+		 *			need to be sorted. If a key is repeated only its first
+		 *			value is stored
+		 * @note	it will be stored up to N entries */
+		ArrayFlatMap(std::initializer_list<std::pair<K, V>> list);
+
+		/** Returns the value of the given key, adding it if the key isn't
+		 * in the ArrayFlatMap
+		 *
+		 * @param	key the key of the value
+		 * @return	a reference to the value
+		 * @note	if the key isn't in the ArrayFlatMap and it's full, it
+		 *			causes undefined behavior */
+		V& operator[](const K& key) { return *emplace(key).first; };
+
+		/** @return	the number of entries in the ArrayFlatMap */
+		size_type size() const { return mKeys.size(); };
+
+		/** @return	the maximum number of entries that the ArrayFlatMap can
+		 *			store */
+		size_type capacity() const { return N; };
+
+		/** @return	true if the ArrayFlatMap has no entries, false
+		 *			otherwise */
+		bool empty() const { return mKeys.empty(); };
+
+		/** @return	true if the ArrayFlatMap can't store more entries, false
+		 *			otherwise */
+		bool full() const { return (mKeys.size() == N); };
+
+		/** @return	the sorted keys of the ArrayFlatMap */
+		const ArrayVector<K, N>& keys() const { return mKeys; };
+
+		/** @return	the values of the ArrayFlatMap, in the same order than
+		 *			its keys */
+		const ArrayVector<V, N>& values() const { return mValues; };
+
+		/** Returns the key located at the given position
+		 *
+		 * @param	i the position of the key
+		 * @return	a reference to the key */
+		const K& getKey(size_type i) const { return mKeys[i]; };
+
+		/** Returns the value located at the given position
+		 *
+		 * @param	i the position of the value
+		 * @return	a reference to the value */
+		V& getValue(size_type i) { return mValues[i]; };
+
+		/** Returns the value located at the given position
+		 *
+		 * @param	i the position of the value
+		 * @return	a reference to the value */
+		const V& getValue(size_type i) const { return mValues[i]; };
+
+		/** @return	the memory used by the ArrayFlatMap */
+		MemoryStats getMemoryStats() const;
+
+		/** Searchs the given key
+		 *
+		 * @param	key the key to search
+		 * @return	the position of the key and its value, @see npos if it
+		 *			wasn't found */
+		size_type getPosition(const K& key) const;
+
+		/** Searchs the value of the given key
+		 *
+		 * @param	key the key to search
+		 * @return	a pointer to the value, nullptr if it wasn't found */
+		V* find(const K& key);
+
+		/** Searchs the value of the given key
+		 *
+		 * @param	key the key to search
+		 * @return	a pointer to the value, nullptr if it wasn't found */
+		const V* find(const K& key) const;
+
+		/** Checks if the ArrayFlatMap has the given key
+		 *
+		 * @param	key the key to search
+		 * @return	true if the key was found, false otherwise */
+		bool contains(const K& key) const { return getPosition(key) != npos; };
+
+		/** Removes all the entries of the ArrayFlatMap */
+		void clear() { mKeys.clear(); mValues.clear(); };
+
+		/** Adds the given entry to the ArrayFlatMap
+		 *
+		 * @param	key the key of the entry
+		 * @param	value the value of the entry
+		 * @return	a pair with a pointer to the value of the key and a
+		 *			boolean that tells if the entry was added or the key was
+		 *			already in the ArrayFlatMap (its value isn't replaced)
+		 * @note	if the key isn't in the ArrayFlatMap and it's full, it
+		 *			causes undefined behavior */
+		std::pair<V*, bool> insert(const K& key, const V& value)
+		{ return emplace(key, value); };
+
+		/** Adds a new entry to the ArrayFlatMap
+		 *
+		 * @param	key the key of the entry
+		 * @param	args the arguments needed for calling the constructor of
+		 *			the new value
+		 * @return	a pair with a pointer to the value of the key and a
+		 *			boolean that tells if the entry was added or the key was
+		 *			already in the ArrayFlatMap (its value isn't replaced)
+		 * @note	if the key isn't in the ArrayFlatMap and it's full, it
+		 *			causes undefined behavior */
+		template <typename... Args>
+		std::pair<V*, bool> emplace(const K& key, Args&&... args);
+
+		/** Removes the given key and its value from the ArrayFlatMap
+		 *
+		 * @param	key the key to remove
+		 * @return	the number of removed entries */
+		size_type erase(const K& key);
+	};
+
+}
+
+#include "ArrayFlatMap.hpp"
+
+#endif		// STDEXT_ARRAY_FLAT_MAP_H
@@ -0,0 +1,85 @@
+#ifndef STDEXT_ARRAY_FLAT_MAP_HPP
+#define STDEXT_ARRAY_FLAT_MAP_HPP
+
+namespace stdext {
+
+	template <typename K, typename V, std::size_t N, typename C>
+	ArrayFlatMap<K, V, N, C>::ArrayFlatMap(std::initializer_list<std::pair<K, V>> list)
+	{
+		for (const std::pair<K, V>& entry : list) {
+			if (full()) {
+				break;
+			}
+			emplace(entry.first, entry.second);
+		}
+	}
+
+
+	template <typename K, typename V, std::size_t N, typename C>
+	MemoryStats ArrayFlatMap<K, V, N, C>::getMemoryStats() const
+	{
+		MemoryStats stats = mKeys.getMemoryStats();
+		stats += mValues.getMemoryStats();
+		stats.numElements = mKeys.size();
+		return stats;
+	}
+
+
+	template <typename K, typename V, std::size_t N, typename C>
+	typename ArrayFlatMap<K, V, N, C>::size_type ArrayFlatMap<K, V, N, C>::getPosition(const K& key) const
+	{
+		size_type i = flatLowerBound<N>(mKeys.data(), mKeys.size(), key, C());
+		return ((i < mKeys.size()) && !C()(key, mKeys[i]))? i : npos;
+	}
+
+
+	template <typename K, typename V, std::size_t N, typename C>
+	V* ArrayFlatMap<K, V, N, C>::find(const K& key)
+	{
+		size_type i = getPosition(key);
+		return (i != npos)? &mValues[i] : nullptr;
+	}
+
+
+	template <typename K, typename V, std::size_t N, typename C>
+	const V* ArrayFlatMap<K, V, N, C>::find(const K& key) const
+	{
+		size_type i = getPosition(key);
+		return (i != npos)? &mValues[i] : nullptr;
+	}
+
+
+	template <typename K, typename V, std::size_t N, typename C>
+	template <typename... Args>
+	std::pair<V*, bool> ArrayFlatMap<K, V, N, C>::emplace(const K& key, Args&&... args)
+	{
+		size_type i = flatLowerBound<N>(mKeys.data(), mKeys.size(), key, C());
+		if ((i < mKeys.size()) && !C()(key, mKeys[i])) {
+			return { &mValues[i], false };
+		}
+
+		// The value is constructed first, so the keys and values stay
+		// paired if its constructor throws
+		V value(std::forward<Args>(args)...);
+		mKeys.insert(mKeys.begin() + i, key);
+		mValues.insert(mValues.begin() + i, std::move(value));
+		return { &mValues[i], true };
+	}
+
+
+	template <typename K, typename V, std::size_t N, typename C>
+	typename ArrayFlatMap<K, V, N, C>::size_type ArrayFlatMap<K, V, N, C>::erase(const K& key)
+	{
+		size_type i = getPosition(key);
+		if (i == npos) {
+			return 0;
+		}
+
+		mKeys.erase(mKeys.begin() + i);
+		mValues.erase(mValues.begin() + i);
+		return 1;
+	}
+
+}
+
+#endif		// STDEXT_ARRAY_FLAT_MAP_HPP
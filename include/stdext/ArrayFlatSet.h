@@ -0,0 +1,144 @@
+#ifndef STDEXT_ARRAY_FLAT_SET_H
+#define STDEXT_ARRAY_FLAT_SET_H
+
+#include <utility>
+#include <functional>
+#include "ArrayVector.h"
+
+namespace stdext {
+
+	/** Returns the position of the first key of the given sorted keys that
+	 * isn't lower than the given one. The 32 bit integral keys of small
+	 * arrays compared with std::less are searched with a SIMD linear scan if
+	 * SSE2 is available, the other ones with a branchless binary search
+	 *
+	 * @param	keys a pointer to the sorted keys
+	 * @param	numKeys the number of keys
+	 * @param	key the key to search
+	 * @param	compare the comparison function of the keys
+	 * @return	the position of the key, @param numKeys if all the keys are
+	 *			lower than @param key */
+	template <std::size_t N, typename K, typename C>
+	std::size_t flatLowerBound(
+		const K* keys, std::size_t numKeys, const K& key, const C& compare
+	);
+
+
+	/**
+	 * Class ArrayFlatSet, it's a set of keys of type @tparam K with a
+	 * compile-time maximum size of @tparam N keys. The keys are stored
+	 * sorted with @tparam C inside an ArrayVector, so they are contiguous and
+	 * the ArrayFlatSet won't do any allocation at runtime.
+	 *
+	 * @note	the comparison function @tparam C must be default
+	 *			constructible, it isn't stored inside the ArrayFlatSet
+	 */
+	template <typename K, std::size_t N, typename C = std::less<K>>
+	class ArrayFlatSet
+	{
+	public:		// Nested types
+		using size_type					= std::size_t;
+		using key_type					= K;
+		using value_type				= K;
+		using key_compare				= C;
+		using iterator					= const K*;
+		using const_iterator			= const K*;
+
+	private:	// Attributes
+		/** The sorted keys of the ArrayFlatSet */
+		ArrayVector<K, N> mKeys;
+
+	public:		// Functions
+		/** Creates a new ArrayFlatSet */
+		ArrayFlatSet() = default;
+
+		/** Creates a new ArrayFlatSet
+		 *
+		 * @param	list the initial keys of the ArrayFlatSet, they don't need
+		 *			to be sorted
+		 * @note	it will be stored up to N keys */
+		ArrayFlatSet(std::initializer_list<K> list);
+
+		/** @return	the initial iterator of the ArrayFlatSet */
+		const_iterator begin() const { return mKeys.begin(); };
+
+		/** @return	the final iterator of the ArrayFlatSet */
+		const_iterator end() const { return mKeys.end(); };
+
+		/** @return	the number of keys in the ArrayFlatSet */
+		size_type size() const { return mKeys.size(); };
+
+		/** @return	the maximum number of keys that the ArrayFlatSet can
+		 *			store */
+		size_type capacity() const { return N; };
+
+		/** @return	true if the ArrayFlatSet has no keys, false otherwise */
+		bool empty() const { return mKeys.empty(); };
+
+		/** @return	true if the ArrayFlatSet can't store more keys, false
+		 *			otherwise */
+		bool full() const { return (mKeys.size() == N); };
+
+		/** @return	a pointer to the sorted keys of the ArrayFlatSet */
+		const K* data() const { return mKeys.data(); };
+
+		/** @return	the memory used by the ArrayFlatSet */
+		MemoryStats getMemoryStats() const { return mKeys.getMemoryStats(); };
+
+		/** Returns the first key that isn't lower than the given one
+		 *
+		 * @param	key the key to search
+		 * @return	an iterator to the key, end if there isn't any */
+		const_iterator lower_bound(const K& key) const
+		{ return begin() + flatLowerBound<N>(data(), size(), key, C()); };
+
+		/** Searchs the given key
+		 *
+		 * @param	key the key to search
+		 * @return	an iterator to the key, end if it wasn't found */
+		const_iterator find(const K& key) const;
+
+		/** Checks if the ArrayFlatSet has the given key
+		 *
+		 * @param	key the key to search
+		 * @return	true if the key was found, false otherwise */
+		bool contains(const K& key) const { return find(key) != end(); };
+
+		/** Counts the number of times the given key is in the ArrayFlatSet
+		 *
+		 * @param	key the key to search
+		 * @return	1 if the key was found, 0 otherwise */
+		size_type count(const K& key) const { return contains(key)? 1 : 0; };
+
+		/** Removes all the keys of the ArrayFlatSet */
+		void clear() { mKeys.clear(); };
+
+		/** Adds the given key to the ArrayFlatSet
+		 *
+		 * @param	key the key to add
+		 * @return	a pair with an iterator to the key and a boolean that
+		 *			tells if the key was added or it was already in the
+		 *			ArrayFlatSet
+		 * @note	if the key isn't in the ArrayFlatSet and it's full, it
+		 *			causes undefined behavior */
+		std::pair<iterator, bool> insert(const K& key);
+
+		/** Removes the given key from the ArrayFlatSet
+		 *
+		 * @param	key the key to remove
+		 * @return	the number of removed keys */
+		size_type erase(const K& key);
+
+		/** Removes the key pointed by the given iterator
+		 *
+		 * @param	it an iterator to the key to remove
+		 * @return	an iterator to the key after the removed one */
+		iterator erase(const_iterator it)
+		{ return mKeys.erase(it); };
+	};
+
+}
+
+#include "ArrayFlatSet.hpp"
+
+#endif		// STDEXT_ARRAY_FLAT_SET_H
@@ -0,0 +1,112 @@
+#ifndef STDEXT_ARRAY_FLAT_SET_HPP
+#define STDEXT_ARRAY_FLAT_SET_HPP
+
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#define STDEXT_ARRAY_FLAT_SET_SSE2
+#endif
+
+namespace stdext {
+
+	template <std::size_t N, typename K, typename C>
+	std::size_t flatLowerBound(
+		const K* keys, std::size_t numKeys, const K& key, const C& compare
+	) {
+#ifdef STDEXT_ARRAY_FLAT_SET_SSE2
+		// With a few keys the linear scan is faster than the binary search,
+		// since it has no dependency between the loads
+		if constexpr ((N <= 64) && std::is_integral_v<K> && (sizeof(K) == 4)
+			&& std::is_same_v<C, std::less<K>>
+		) {
+			// The unsigned keys are biased, since SSE2 only has signed
+			// comparisons
+			const std::int32_t bias = std::is_signed_v<K>? 0 : INT32_MIN;
+			const __m128i vBias = _mm_set1_epi32(bias);
+			const __m128i vKey = _mm_set1_epi32(static_cast<std::int32_t>(key) ^ bias);
+
+			std::size_t i = 0;
+			for (; i + 4 <= numKeys; i += 4) {
+				__m128i vKeys = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i));
+				vKeys = _mm_xor_si128(vKeys, vBias);
+				int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(vKeys, vKey)));
+				if (mask != 0xF) {
+					// The keys are sorted, so the lower ones are the first
+					// lanes of the mask
+					return i + (mask & 1) + ((mask >> 1) & 1) + ((mask >> 2) & 1);
+				}
+			}
+			for (; (i < numKeys) && (keys[i] < key); ++i);
+
+			return i;
+		}
+#endif
+
+		if (numKeys == 0) {
+			return 0;
+		}
+
+		// The comparison only selects the next base, so the compiler can use
+		// a conditional move instead of a branch
+		const K* base = keys;
+		while (numKeys > 1) {
+			std::size_t half = numKeys / 2;
+			base = compare(base[half - 1], key)? base + half : base;
+			numKeys -= half;
+		}
+
+		return (base - keys) + (compare(*base, key)? 1 : 0);
+	}
+
+
+	template <typename K, std::size_t N, typename C>
+	ArrayFlatSet<K, N, C>::ArrayFlatSet(std::initializer_list<K> list)
+	{
+		for (const K& key : list) {
+			if (full()) {
+				break;
+			}
+			insert(key);
+		}
+	}
+
+
+	template <typename K, std::size_t N, typename C>
+	typename ArrayFlatSet<K, N, C>::const_iterator ArrayFlatSet<K, N, C>::find(const K& key) const
+	{
+		const_iterator it = lower_bound(key);
+		return ((it != end()) && !C()(key, *it))? it : end();
+	}
+
+
+	template <typename K, std::size_t N, typename C>
+	std::pair<typename ArrayFlatSet<K, N, C>::iterator, bool> ArrayFlatSet<K, N, C>::insert(const K& key)
+	{
+		const_iterator it = lower_bound(key);
+		if ((it != end()) && !C()(key, *it)) {
+			return { it, false };
+		}
+
+		return { mKeys.insert(it, key), true };
+	}
+
+
+	template <typename K, std::size_t N, typename C>
+	typename ArrayFlatSet<K, N, C>::size_type ArrayFlatSet<K, N, C>::erase(const K& key)
+	{
+		const_iterator it = find(key);
+		if (it == end()) {
+			return 0;
+		}
+
+		mKeys.erase(it);
+		return 1;
+	}
+
+}
+
+#undef STDEXT_ARRAY_FLAT_SET_SSE2
+
+#endif		// STDEXT_ARRAY_FLAT_SET_HPP
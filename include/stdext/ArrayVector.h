@@ -1,23 +1,162 @@
 #ifndef STDEXT_ARRAY_VECTOR_H
 #define STDEXT_ARRAY_VECTOR_H
 
+#include <memory>
+#include <cstdint>
 #include <cstddef>
 #include <iterator>
+#include <type_traits>
 #include <initializer_list>
+#include "MemoryStats.h"
 
 namespace stdext {
 
+#if defined(__GNUC__) || defined(__clang__) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+	#define STDEXT_HAS_IS_CONSTANT_EVALUATED
+#endif
+
+	/** @return	true if the function is being evaluated in a constant
+	 *			expression, false otherwise. If the compiler can't detect it,
+	 *			it always returns false */
+	constexpr bool isConstantEvaluated()
+	{
+#ifdef STDEXT_HAS_IS_CONSTANT_EVALUATED
+		return __builtin_is_constant_evaluated();
+#else
+		return false;
+#endif
+	}
+
+
+	/** The smallest unsigned integer type that can hold the number @tparam N
+	 * (uint8_t, uint16_t, uint32_t or size_t) */
+	template <std::size_t N>
+	using SmallestUnsigned = std::conditional_t<(N <= UINT8_MAX), std::uint8_t,
+		std::conditional_t<(N <= UINT16_MAX), std::uint16_t,
+		std::conditional_t<(N <= UINT32_MAX), std::uint32_t, std::size_t>>>;
+
+
+	/** If @tparam T can be stored in the ArrayVectors usable in constant
+	 * expressions */
+	template <typename T>
+	constexpr bool kIsConstexprStorable =
+		std::is_trivially_default_constructible_v<T>
+		&& std::is_trivially_copyable_v<T>
+		&& std::is_trivially_destructible_v<T>;
+
+
+	/**
+	 * Class ArrayVectorStorage, it holds the memory where the elements of an
+	 * ArrayVector are stored, aligned to @tparam Alignment. If
+	 * @tparam isConstexpr is true, the elements are stored in an array of
+	 * @tparam T, so the ArrayVector can be used in constant expressions.
+	 */
+	template <typename T, std::size_t N, std::size_t Alignment, bool isConstexpr>
+	class ArrayVectorStorage
+	{
+	protected:	// Attributes
+		/** The array where the elements will be stored. It's value
+		 * initialized since the constant expressions can't have
+		 * uninitialized memory, so the whole array is initialized and
+		 * copied */
+		alignas(Alignment) T mData[N] = {};
+
+		/** The number of Elements added to the ArrayVector */
+		SmallestUnsigned<N> mNumElements = 0;
+
+	protected:	// Functions
+		/** Creates a new ArrayVectorStorage */
+		ArrayVectorStorage() = default;
+		ArrayVectorStorage(const ArrayVectorStorage& other) = default;
+
+		/** The moved ArrayVectorStorage is left empty, like the non trivial
+		 * one */
+		constexpr ArrayVectorStorage(ArrayVectorStorage&& other) :
+			ArrayVectorStorage(static_cast<const ArrayVectorStorage&>(other))
+		{ other.mNumElements = 0; };
+
+		/** Assignment operator */
+		ArrayVectorStorage& operator=(const ArrayVectorStorage& other) = default;
+		constexpr ArrayVectorStorage& operator=(ArrayVectorStorage&& other)
+		{
+			if (this != &other) {
+				*this = static_cast<const ArrayVectorStorage&>(other);
+				other.mNumElements = 0;
+			}
+			return *this;
+		};
+
+		/** @return	a pointer to the first element */
+		constexpr T* getData() { return mData; };
+
+		/** @return	a pointer to the first element */
+		constexpr const T* getData() const { return mData; };
+	};
+
+
+	/**
+	 * Class ArrayVectorStorage, it holds the memory where the elements of an
+	 * ArrayVector are stored. The elements are stored in an array of bytes,
+	 * so they are only constructed when they are added, and only the added
+	 * ones are copied.
+	 */
+	template <typename T, std::size_t N, std::size_t Alignment>
+	class ArrayVectorStorage<T, N, Alignment, false>
+	{
+	protected:	// Attributes
+		/** The array of memory where the elements will be stored */
+		alignas(Alignment) std::byte mData[N * sizeof(T)];
+
+		/** The number of Elements added to the ArrayVector */
+		SmallestUnsigned<N> mNumElements;
+
+	protected:	// Functions
+		/** Creates a new ArrayVectorStorage */
+		ArrayVectorStorage() : mNumElements(0) {};
+		ArrayVectorStorage(const ArrayVectorStorage& other);
+		ArrayVectorStorage(ArrayVectorStorage&& other);
+
+		/** Class destructor */
+		~ArrayVectorStorage() { std::destroy_n(getData(), mNumElements); };
+
+		/** Assignment operator */
+		ArrayVectorStorage& operator=(const ArrayVectorStorage& other);
+		ArrayVectorStorage& operator=(ArrayVectorStorage&& other);
+
+		/** @return	a pointer to the first element */
+		T* getData() { return reinterpret_cast<T*>(mData); };
+
+		/** @return	a pointer to the first element */
+		const T* getData() const { return reinterpret_cast<const T*>(mData); };
+	};
+
+
 	/**
 	 * Class ArrayVector, a ArrayVector is a container of elements of type
 	 * @tparam T with a compile-time maximum size of @tparam N elements but
 	 * which can vary the number of elements stored inside. Internally the
 	 * ArrayVector stores the elements contiguously so they could be accessed
 	 * with pointers and offsets. The ArrayVector won't do any allocation at
-	 * runtime.
+	 * runtime. The number of elements is stored in the smallest integer type
+	 * that can hold @tparam N, and the elements can be over-aligned to
+	 * @tparam Alignment bytes (for example for SIMD loads).
+	 * If @tparam isConstexpr is true, the ArrayVector can also be used in
+	 * constant expressions, but @tparam T must be trivial and all the N
+	 * elements are initialized on construction and copied on every copy.
+	 * @see ConstexprArrayVector
 	 */
-	template <typename T, std::size_t N>
-	class ArrayVector
+	template <typename T, std::size_t N, std::size_t Alignment = alignof(T),
+		bool isConstexpr = false
+	>
+	class ArrayVector : private ArrayVectorStorage<T, N, Alignment, isConstexpr>
 	{
+		static_assert(
+			(Alignment >= alignof(T)) && ((Alignment & (Alignment - 1)) == 0),
+			"The Alignment must be a power of two not lower than alignof(T)"
+		);
+		static_assert(!isConstexpr || kIsConstexprStorable<T>,
+			"The ArrayVectors usable in constant expressions need a trivial T");
+
 	public:		// Nested types
 		using size_type					= std::size_t;
 		using difference_type			= std::ptrdiff_t;
@@ -29,18 +168,17 @@ namespace stdext {
 		using reverse_iterator			= std::reverse_iterator<iterator>;
 		using const_reverse_iterator	= std::reverse_iterator<const_iterator>;
 
-	private:	// Attributes
-		/** The array of memory where the elements will be stored */
-		std::byte mData[N * sizeof(T)];
+	private:
+		using Storage = ArrayVectorStorage<T, N, Alignment, isConstexpr>;
+		using Storage::mNumElements;
 
-		/** The number of Elements added to the ArrayVector */
-		size_type mNumElements;
+		/** If the elements are stored in an array of T, so they are always
+		 * constructed and can be used in constant expressions */
+		static constexpr bool kIsTrivial = isConstexpr;
 
 	public:		// Functions
 		/** Creates a new ArrayVector */
-		ArrayVector() : mNumElements(0) {};
-		ArrayVector(const ArrayVector& other);
-		ArrayVector(ArrayVector&& other);
+		ArrayVector() = default;
 
 		/** Creates a new ArrayVector
 		 *
@@ -49,51 +187,46 @@ namespace stdext {
 		 *			elements the ArrayVector can store, it will be set to 0
 		 * @param	value the initial value with which the new values will be
 		 *			intialized */
-		ArrayVector(size_type numElements, const T& value = T()) :
-			mNumElements(0) { resize(numElements, value); };
+		constexpr ArrayVector(size_type numElements, const T& value = T())
+		{ resize(numElements, value); };
 
 		/** Creates a new ArrayVector
 		 *
 		 * @param	list the initial elements stored inside the ArrayVector
 		 * @note	it will be stored up to N elements */
-		ArrayVector(std::initializer_list<T> list);
+		constexpr ArrayVector(std::initializer_list<T> list);
 
 		/** Creates a new ArrayVector
 		 *
 		 * @param	first the first iterator of the range to copy
 		 * @param	last the past-the-end iterator of the range to copy */
-		template <typename InputIterator>
-		ArrayVector(InputIterator first, InputIterator last);
-
-		/** Class destructor */
-		~ArrayVector();
-
-		/** Assignment operator */
-		ArrayVector& operator=(const ArrayVector& other);
-		ArrayVector& operator=(ArrayVector&& other);
+		template <typename InputIterator, typename = typename
+			std::iterator_traits<InputIterator>::iterator_category
+		>
+		constexpr ArrayVector(InputIterator first, InputIterator last);
 
 		/** Returns the Element i of the ArrayVector
 		 *
 		 * @param	i the index of the Element
 		 * @return	a reference to the Element */
-		T& operator[](size_type i)
-		{ return reinterpret_cast<T*>(mData)[i]; };
+		constexpr T& operator[](size_type i) { return data()[i]; };
 
 		/** Returns the Element i of the ArrayVector
 		 *
 		 * @param	i the index of the Element
 		 * @return	a const reference to the Element */
-		const T& operator[](size_type i) const
-		{ return reinterpret_cast<const T*>(mData)[i]; };
+		constexpr const T& operator[](size_type i) const
+		{ return data()[i]; };
 
 		/** Compares the given ArrayVectors
 		 *
 		 * @param	lhs the first ArrayVector to compare
 		 * @param	rhs the second ArrayVector to compare
 		 * @return	true if both ArrayVector are equal, false otherwise */
-		template <typename U, std::size_t N2>
-		friend bool operator==(
-			const ArrayVector<U, N2>& lhs, const ArrayVector<U, N2>& rhs
+		template <typename U, std::size_t N2, std::size_t A2, bool C2>
+		friend constexpr bool operator==(
+			const ArrayVector<U, N2, A2, C2>& lhs,
+			const ArrayVector<U, N2, A2, C2>& rhs
 		);
 
 		/** Compares the given ArrayVectors
@@ -101,84 +234,89 @@ namespace stdext {
 		 * @param	lhs the first ArrayVector to compare
 		 * @param	rhs the second ArrayVector to compare
 		 * @return	true if both ArrayVector are different, false otherwise */
-		template <typename U, std::size_t N2>
-		friend bool operator!=(
-			const ArrayVector<U, N2>& lhs, const ArrayVector<U, N2>& rhs
+		template <typename U, std::size_t N2, std::size_t A2, bool C2>
+		friend constexpr bool operator!=(
+			const ArrayVector<U, N2, A2, C2>& lhs,
+			const ArrayVector<U, N2, A2, C2>& rhs
 		);
 
 		/** @return	the initial iterator of the ArrayVector */
-		iterator begin()
-		{ return reinterpret_cast<T*>(mData); };
+		constexpr iterator begin() { return data(); };
 
 		/** @return	the initial iterator of the ArrayVector */
-		const_iterator begin() const
-		{ return reinterpret_cast<const T*>(mData); };
+		constexpr const_iterator begin() const { return data(); };
 
 		/** @return	the final iterator of the ArrayVector */
-		iterator end()
-		{ return reinterpret_cast<T*>(mData) + mNumElements; };
+		constexpr iterator end() { return data() + mNumElements; };
 
 		/** @return	the final iterator of the ArrayVector */
-		const_iterator end() const
-		{ return reinterpret_cast<const T*>(mData) + mNumElements; };
+		constexpr const_iterator end() const
+		{ return data() + mNumElements; };
 
 		/** @return	the initial reverse iterator of the ArrayVector */
-		reverse_iterator rbegin()
-		{ return reinterpret_cast<T*>(mData) + mNumElements; };
+		constexpr reverse_iterator rbegin()
+		{ return reverse_iterator(end()); };
 
-		/** @return	the final reverse iterator of the ArrayVector */
-		const_reverse_iterator rbegin() const
-		{ return reinterpret_cast<const T*>(mData) + mNumElements; };
+		/** @return	the initial reverse iterator of the ArrayVector */
+		constexpr const_reverse_iterator rbegin() const
+		{ return const_reverse_iterator(end()); };
 
 		/** @return	the final reverse iterator of the ArrayVector */
-		reverse_iterator rend()
-		{ return reinterpret_cast<T*>(mData); };
+		constexpr reverse_iterator rend()
+		{ return reverse_iterator(begin()); };
 
-		/** @return	the initial reverse iterator of the ArrayVector */
-		const_reverse_iterator rend() const
-		{ return reinterpret_cast<const T*>(mData); };
+		/** @return	the final reverse iterator of the ArrayVector */
+		constexpr const_reverse_iterator rend() const
+		{ return const_reverse_iterator(begin()); };
 
 		/** @return	the number of Elements in the ArrayVector */
-		size_type size() const { return mNumElements; };
+		constexpr size_type size() const { return mNumElements; };
 
 		/** @return	the maximum number of Elements that can be stored in the
 		 *			ArrayVector */
-		size_type capacity() const { return N; };
+		constexpr size_type capacity() const { return N; };
 
 		/** @return	true if the ArrayVector has no Elements inside, false
 		 *			otherwise */
-		bool empty() const { return (mNumElements == 0); };
+		constexpr bool empty() const { return (mNumElements == 0); };
+
+		/** @return	the memory used by the ArrayVector. It doesn't do any
+		 *			allocation, so the reserved bytes are the ones of its
+		 *			internal array */
+		MemoryStats getMemoryStats() const
+		{
+			MemoryStats stats;
+			stats.reservedBytes = N * sizeof(T);
+			stats.liveBytes = mNumElements * sizeof(T);
+			stats.numElements = mNumElements;
+			return stats;
+		};
 
 		/** @return	a reference to the first element in the ArrayVector
 		 * @note	if the ArrayVector is empty, it causes undefined behavior */
-		T& front()
-		{ return reinterpret_cast<T*>(mData)[0]; };
+		constexpr T& front() { return data()[0]; };
 
 		/** @return	a reference to the first element in the ArrayVector
 		 * @note	if the ArrayVector is empty, it causes undefined behavior */
-		const T& front() const
-		{ return reinterpret_cast<const T*>(mData)[0]; };
+		constexpr const T& front() const { return data()[0]; };
 
 		/** @return	a reference to the last element in the ArrayVector
 		 * @note	if the ArrayVector is empty, it causes undefined behavior */
-		T& back()
-		{ return reinterpret_cast<T*>(mData)[mNumElements - 1]; };
+		constexpr T& back() { return data()[mNumElements - 1]; };
 
 		/** @return	a reference to the last element in the ArrayVector
 		 * @note	if the ArrayVector is empty, it causes undefined behavior */
-		const T& back() const
-		{ return reinterpret_cast<const T*>(mData)[mNumElements - 1]; };
+		constexpr const T& back() const
+		{ return data()[mNumElements - 1]; };
 
 		/** @return	a pointer to the first element stored in the ArrayVector */
-		T* data()
-		{ return reinterpret_cast<T*>(mData); };
+		constexpr T* data() { return Storage::getData(); };
 
 		/** @return	a pointer to the first element stored in the ArrayVector */
-		const T* data() const
-		{ return reinterpret_cast<const T*>(mData); };
+		constexpr const T* data() const { return Storage::getData(); };
 
 		/** Removes all the elements in the ArrayVector */
-		void clear();
+		constexpr void clear();
 
 		/** Changes the number of elements stored in the ArrayVector
 		 *
@@ -188,13 +326,13 @@ namespace stdext {
 		 *			intialized
 		 * @note	the new number of elements will be set to @tparam N if
 		 *			numElements is larger */
-		void resize(size_type numElements, const T& value = T());
+		constexpr void resize(size_type numElements, const T& value = T());
 
 		/** Adds a new Element at the back of the ArrayVector
 		 *
 		 * @param	element the Element to push at the back of the ArrayVector
 		 * @note	if the ArrayVector is full, it causes undefined behavior */
-		void push_back(const T& element);
+		constexpr void push_back(const T& element);
 
 		/** Adds a new Element at the back of the ArrayVector
 		 *
@@ -203,11 +341,11 @@ namespace stdext {
 		 * @return	a reference to the new element
 		 * @note	if the ArrayVector is full, it causes undefined behavior */
 		template <typename... Args>
-		T& emplace_back(Args&&... args);
+		constexpr T& emplace_back(Args&&... args);
 
 		/** Removes the last Element of the ArrayVector
 		 * @note	if the ArrayVector is empty, it causes undefined behavior */
-		void pop_back();
+		constexpr void pop_back();
 
 		/** Inserts the given element into the ArrayVector at the position
 		 * located at the given iterator
@@ -216,7 +354,9 @@ namespace stdext {
 		 * @param	value the element to insert
 		 * @note	the next stored elements will be displaced one position
 		 *			right inside the ArrayVector */
-		iterator insert(const_iterator it, const T& value);
+		constexpr iterator insert(const_iterator it, const T& value);
+		constexpr iterator insert(const_iterator it, T&& value)
+		{ return emplace(it, std::move(value)); };
 
 		/** Inserts the given element into the ArrayVector at the position
 		 * located at the given iterator
@@ -225,9 +365,84 @@ namespace stdext {
 		 * @param	args the arguments needed for calling the constructor of
 		 *			the new Element
 		 * @note	the next stored elements will be displaced one position
-		 *			right inside the ArrayVector */
+		 *			right inside the ArrayVector. At the back the Element is
+		 *			constructed in place, otherwise it's constructed before
+		 *			displacing the next elements (the arguments could
+		 *			reference them) and then moved to its position */
 		template <typename... Args>
-		iterator emplace(const_iterator it, Args&&... args);
+		constexpr iterator emplace(const_iterator it, Args&&... args);
+
+		/** Inserts the elements of the given range into the ArrayVector at
+		 * the position located at the given iterator
+		 *
+		 * @param	it an iterator to the position to insert the elements
+		 * @param	first the first iterator of the range to insert
+		 * @param	last the past-the-end iterator of the range to insert
+		 * @return	an iterator to the first inserted element
+		 * @note	the next stored elements will be displaced only once. The
+		 *			range mustn't be part of the ArrayVector */
+		template <typename InputIterator, typename = typename
+			std::iterator_traits<InputIterator>::iterator_category
+		>
+		constexpr iterator insert(
+			const_iterator it, InputIterator first, InputIterator last
+		);
+
+		/** Inserts copies of the given element into the ArrayVector at the
+		 * position located at the given iterator
+		 *
+		 * @param	it an iterator to the position to insert the elements
+		 * @param	count the number of copies to insert
+		 * @param	value the element to insert
+		 * @return	an iterator to the first inserted element
+		 * @note	the next stored elements will be displaced only once */
+		constexpr iterator insert(
+			const_iterator it, size_type count, const T& value
+		);
+
+		/** Inserts the given elements into the ArrayVector at the position
+		 * located at the given iterator
+		 *
+		 * @param	it an iterator to the position to insert the elements
+		 * @param	list the elements to insert
+		 * @return	an iterator to the first inserted element */
+		constexpr iterator insert(
+			const_iterator it, std::initializer_list<T> list
+		)
+		{ return insert(it, list.begin(), list.end()); };
+
+		/** Replaces the elements of the ArrayVector with the ones of the
+		 * given range
+		 *
+		 * @param	first the first iterator of the range to copy
+		 * @param	last the past-the-end iterator of the range to copy */
+		template <typename InputIterator, typename = typename
+			std::iterator_traits<InputIterator>::iterator_category
+		>
+		constexpr void assign(InputIterator first, InputIterator last)
+		{ clear(); insert(end(), first, last); }
+
+		/** Replaces the elements of the ArrayVector with copies of the given
+		 * one
+		 *
+		 * @param	count the number of copies
+		 * @param	value the element to copy */
+		constexpr void assign(size_type count, const T& value)
+		{ clear(); resize(count, value); };
+
+		/** Replaces the elements of the ArrayVector with the given ones
+		 *
+		 * @param	list the elements to copy */
+		constexpr void assign(std::initializer_list<T> list)
+		{ assign(list.begin(), list.end()); };
+
+		/** Adds the elements of the given range at the back of the
+		 * ArrayVector
+		 *
+		 * @param	range the range with the elements to add */
+		template <typename R>
+		constexpr void append_range(R&& range)
+		{ insert(end(), std::begin(range), std::end(range)); }
 
 		/** Removes the element located at the given iterator from the
 		 * ArrayVector
@@ -235,9 +450,37 @@ namespace stdext {
 		 * @param	it an iterator to the Element
 		 * @note	the next stored elements will be displaced one position
 		 *			left inside the ArrayVector */
-		iterator erase(const_iterator it);
+		constexpr iterator erase(const_iterator it);
+	private:
+		/** Moves the elements located at the given iterator and after it
+		 * the given number of positions to the right
+		 *
+		 * @param	it an iterator to the first element to move
+		 * @param	count the number of positions to move the elements
+		 * @return	the number of positions of the gap left that still hold
+		 *			(moved-from) elements, the rest must be constructed
+		 * @note	the number of elements isn't updated */
+		constexpr size_type shiftTail(iterator it, size_type count);
+
+		/** Moves the given range of trivial elements to the given position,
+		 * with memmove if it's not being evaluated in a constant
+		 * expression
+		 *
+		 * @param	first the first element to move
+		 * @param	last the past-the-end element to move
+		 * @param	destination the new position of the first element. The
+		 *			ranges can overlap */
+		static constexpr void moveTrivial(
+			T* first, T* last, T* destination
+		);
 	};
 
+
+	/** An ArrayVector that can be used in constant expressions, @see
+	 * ArrayVector */
+	template <typename T, std::size_t N, std::size_t Alignment = alignof(T)>
+	using ConstexprArrayVector = ArrayVector<T, N, Alignment, true>;
+
 }
 
 #include "ArrayVector.hpp"
@@ -2,181 +2,399 @@
 #define STDEXT_ARRAY_VECTOR_HPP
 
 #include <memory>
+#include <cstring>
 #include <algorithm>
+#include <type_traits>
 
 namespace stdext {
 
-	template <typename T, std::size_t N>
-	ArrayVector<T, N>::ArrayVector(const ArrayVector& other) : mNumElements(other.mNumElements)
+	template <typename T, std::size_t N, std::size_t Alignment>
+	ArrayVectorStorage<T, N, Alignment, false>::ArrayVectorStorage(const ArrayVectorStorage& other) :
+		mNumElements(other.mNumElements)
 	{
-		std::uninitialized_copy(other.begin(), other.end(), reinterpret_cast<T*>(mData));
+		if constexpr (std::is_trivially_copyable_v<T>) {
+			std::memcpy(mData, other.mData, mNumElements * sizeof(T));
+		}
+		else {
+			std::uninitialized_copy_n(other.getData(), mNumElements, getData());
+		}
 	}
 
 
-	template <typename T, std::size_t N>
-	ArrayVector<T, N>::ArrayVector(ArrayVector&& other) : mNumElements(other.mNumElements)
+	template <typename T, std::size_t N, std::size_t Alignment>
+	ArrayVectorStorage<T, N, Alignment, false>::ArrayVectorStorage(ArrayVectorStorage&& other) :
+		mNumElements(other.mNumElements)
 	{
-		std::uninitialized_move(other.begin(), other.end(), reinterpret_cast<T*>(mData));
-		other.clear();
+		if constexpr (std::is_trivially_copyable_v<T>) {
+			std::memcpy(mData, other.mData, mNumElements * sizeof(T));
+		}
+		else {
+			std::uninitialized_move_n(other.getData(), mNumElements, getData());
+		}
+		std::destroy_n(other.getData(), other.mNumElements);
+		other.mNumElements = 0;
 	}
 
 
-	template <typename T, std::size_t N>
-	ArrayVector<T, N>::ArrayVector(std::initializer_list<T> list) : mNumElements(0)
+	template <typename T, std::size_t N, std::size_t Alignment>
+	ArrayVectorStorage<T, N, Alignment, false>& ArrayVectorStorage<T, N, Alignment, false>::operator=(const ArrayVectorStorage& other)
 	{
-		size_type i = 0;
-		for (const T& member : list) {
-			if (i < N) {
-				push_back(member);
+		if (this != &other) {
+			std::destroy_n(getData(), mNumElements);
+			mNumElements = other.mNumElements;
+			if constexpr (std::is_trivially_copyable_v<T>) {
+				std::memcpy(mData, other.mData, mNumElements * sizeof(T));
+			}
+			else {
+				std::uninitialized_copy_n(other.getData(), mNumElements, getData());
 			}
-			++i;
 		}
+
+		return *this;
 	}
 
 
-	template <typename T, std::size_t N>
-	template <typename InputIterator>
-	ArrayVector<T, N>::ArrayVector(InputIterator first, InputIterator last) : mNumElements(0)
+	template <typename T, std::size_t N, std::size_t Alignment>
+	ArrayVectorStorage<T, N, Alignment, false>& ArrayVectorStorage<T, N, Alignment, false>::operator=(ArrayVectorStorage&& other)
 	{
-		std::copy(first, last, std::back_inserter(*this));
+		if (this != &other) {
+			std::destroy_n(getData(), mNumElements);
+			mNumElements = other.mNumElements;
+			if constexpr (std::is_trivially_copyable_v<T>) {
+				std::memcpy(mData, other.mData, mNumElements * sizeof(T));
+			}
+			else {
+				std::uninitialized_move_n(other.getData(), mNumElements, getData());
+			}
+			std::destroy_n(other.getData(), other.mNumElements);
+			other.mNumElements = 0;
+		}
+
+		return *this;
 	}
 
 
-	template <typename T, std::size_t N>
-	ArrayVector<T, N>::~ArrayVector()
+	template <typename T, std::size_t N, std::size_t Alignment, bool isConstexpr>
+	constexpr ArrayVector<T, N, Alignment, isConstexpr>::ArrayVector(std::initializer_list<T> list)
 	{
-		clear();
+		size_type i = 0;
+		for (const T& member : list) {
+			if (i < N) {
+				push_back(member);
+			}
+			++i;
+		}
 	}
 
 
-	template <typename T, std::size_t N>
-	ArrayVector<T, N>& ArrayVector<T, N>::operator=(const ArrayVector& other)
+	template <typename T, std::size_t N, std::size_t Alignment, bool isConstexpr>
+	template <typename InputIterator, typename>
+	constexpr ArrayVector<T, N, Alignment, isConstexpr>::ArrayVector(InputIterator first, InputIterator last)
 	{
-		clear();
-		mNumElements = other.mNumElements;
-		std::uninitialized_copy(other.begin(), other.end(), reinterpret_cast<T*>(mData));
-
-		return *this;
+		insert(end(), first, last);
 	}
 
 
-	template <typename T, std::size_t N>
-	ArrayVector<T, N>& ArrayVector<T, N>::operator=(ArrayVector&& other)
+	template <typename T, std::size_t N, std::size_t Alignment, bool isConstexpr>
+	constexpr bool operator==(const ArrayVector<T, N, Alignment, isConstexpr>& lhs, const ArrayVector<T, N, Alignment, isConstexpr>& rhs)
 	{
-		clear();
-		mNumElements = other.mNumElements;
-		std::uninitialized_move(other.begin(), other.end(), reinterpret_cast<T*>(mData));
-		other.clear();
-
-		return *this;
-	}
+		if (lhs.size() != rhs.size()) {
+			return false;
+		}
 
+		for (std::size_t i = 0; i < lhs.size(); ++i) {
+			if (!(lhs[i] == rhs[i])) {
+				return false;
+			}
+		}
 
-	template <typename T, std::size_t N>
-	bool operator==(const ArrayVector<T, N>& lhs, const ArrayVector<T, N>& rhs)
-	{
-		return (lhs.mNumElements == rhs.mNumElements)
-			&& std::equal(lhs.begin(), lhs.end(), rhs.end());
+		return true;
 	}
 
 
-	template <typename T, std::size_t N>
-	bool operator!=(const ArrayVector<T, N>& lhs, const ArrayVector<T, N>& rhs)
+	template <typename T, std::size_t N, std::size_t Alignment, bool isConstexpr>
+	constexpr bool operator!=(const ArrayVector<T, N, Alignment, isConstexpr>& lhs, const ArrayVector<T, N, Alignment, isConstexpr>& rhs)
 	{
 		return !(lhs == rhs);
 	}
 
 
-	template <typename T, std::size_t N>
-	void ArrayVector<T, N>::clear()
+	template <typename T, std::size_t N, std::size_t Alignment, bool isConstexpr>
+	constexpr void ArrayVector<T, N, Alignment, isConstexpr>::clear()
 	{
-		while (!empty()) {
-			pop_back();
+		if constexpr (!kIsTrivial) {
+			std::destroy(begin(), end());
 		}
+		mNumElements = 0;
 	}
 
 
-	template <typename T, std::size_t N>
-	void ArrayVector<T, N>::resize(size_type numElements, const T& value)
+	template <typename T, std::size_t N, std::size_t Alignment, bool isConstexpr>
+	constexpr void ArrayVector<T, N, Alignment, isConstexpr>::resize(size_type numElements, const T& value)
 	{
 		if (numElements > N) {
 			numElements = N;
 		}
 
-		while (numElements < mNumElements) {
-			pop_back();
+		if constexpr (kIsTrivial) {
+			for (size_type i = mNumElements; i < numElements; ++i) {
+				data()[i] = value;
+			}
 		}
-
-		while (numElements > mNumElements) {
-			emplace_back(value);
+		else if (numElements < mNumElements) {
+			std::destroy(begin() + numElements, end());
+		}
+		else {
+			std::uninitialized_fill(end(), begin() + numElements, value);
 		}
+		mNumElements = numElements;
 	}
 
 
-	template <typename T, std::size_t N>
-	void ArrayVector<T, N>::push_back(const T& element)
+	template <typename T, std::size_t N, std::size_t Alignment, bool isConstexpr>
+	constexpr void ArrayVector<T, N, Alignment, isConstexpr>::push_back(const T& element)
 	{
 		emplace_back(element);
 	}
 
 
-	template <typename T, std::size_t N>
+	template <typename T, std::size_t N, std::size_t Alignment, bool isConstexpr>
 	template <typename... Args>
-	T& ArrayVector<T, N>::emplace_back(Args&&... args)
+	constexpr T& ArrayVector<T, N, Alignment, isConstexpr>::emplace_back(Args&&... args)
 	{
-		new (mData + mNumElements * sizeof(T)) T(std::forward<Args>(args)...);
+		if constexpr (kIsTrivial) {
+			data()[mNumElements] = T(std::forward<Args>(args)...);
+		}
+		else {
+			new (data() + mNumElements) T(std::forward<Args>(args)...);
+		}
 		mNumElements++;
 
-		return reinterpret_cast<T*>(mData)[mNumElements - 1];
+		return data()[mNumElements - 1];
 	}
 
 
-	template <typename T, std::size_t N>
-	void ArrayVector<T, N>::pop_back()
+	template <typename T, std::size_t N, std::size_t Alignment, bool isConstexpr>
+	constexpr void ArrayVector<T, N, Alignment, isConstexpr>::pop_back()
 	{
-		back().~T();
+		if constexpr (!kIsTrivial) {
+			back().~T();
+		}
 		mNumElements--;
 	}
 
 
-	template <typename T, std::size_t N>
-	typename ArrayVector<T, N>::iterator ArrayVector<T, N>::insert(const_iterator it, const T& value)
+	template <typename T, std::size_t N, std::size_t Alignment, bool isConstexpr>
+	constexpr typename ArrayVector<T, N, Alignment, isConstexpr>::iterator ArrayVector<T, N, Alignment, isConstexpr>::insert(const_iterator it, const T& value)
 	{
-		iterator itCopy = const_cast<iterator>(it);
-
-		emplace_back( std::move(back()) );
-		for (iterator it2 = end() - 2; it2 != itCopy; --it2) {
-			*it2 = std::move(*(it2 - 1));
+		iterator itCopy = begin() + (it - begin());
+
+		if constexpr (kIsTrivial) {
+			// The value is copied first since it could be stored in the
+			// ArrayVector
+			T valueCopy = value;
+			moveTrivial(itCopy, end(), itCopy + 1);
+			*itCopy = valueCopy;
+			mNumElements++;
+		}
+		else if constexpr (std::is_trivially_copyable_v<T>) {
+			T valueCopy = value;
+			moveTrivial(itCopy, end(), itCopy + 1);
+			std::memcpy(itCopy, &valueCopy, sizeof(T));
+			mNumElements++;
+		}
+		else if (itCopy == end()) {
+			emplace_back(value);
+		}
+		else {
+			T valueCopy = value;
+			emplace_back( std::move(back()) );
+			std::move_backward(itCopy, end() - 2, end() - 1);
+			*itCopy = std::move(valueCopy);
 		}
-		*itCopy = value;
 
 		return itCopy;
 	}
 
 
-	template <typename T, std::size_t N>
+	template <typename T, std::size_t N, std::size_t Alignment, bool isConstexpr>
 	template <typename... Args>
-	typename ArrayVector<T, N>::iterator ArrayVector<T, N>::emplace(const_iterator it, Args&&... args)
+	constexpr typename ArrayVector<T, N, Alignment, isConstexpr>::iterator ArrayVector<T, N, Alignment, isConstexpr>::emplace(const_iterator it, Args&&... args)
 	{
-		return insert(it, T(std::forward<Args>(args)...));
+		iterator itCopy = begin() + (it - begin());
+
+		if (itCopy == end()) {
+			emplace_back(std::forward<Args>(args)...);
+		}
+		else if constexpr (kIsTrivial) {
+			T value(std::forward<Args>(args)...);
+			moveTrivial(itCopy, end(), itCopy + 1);
+			*itCopy = value;
+			mNumElements++;
+		}
+		else if constexpr (std::is_trivially_copyable_v<T>) {
+			T value(std::forward<Args>(args)...);
+			moveTrivial(itCopy, end(), itCopy + 1);
+			std::memcpy(itCopy, &value, sizeof(T));
+			mNumElements++;
+		}
+		else {
+			// The last element is moved to the unconstructed position, so
+			// the displaced one at itCopy is a moved-from element
+			T value(std::forward<Args>(args)...);
+			shiftTail(itCopy, 1);
+			*itCopy = std::move(value);
+			mNumElements++;
+		}
+
+		return itCopy;
+	}
+
+
+	template <typename T, std::size_t N, std::size_t Alignment, bool isConstexpr>
+	template <typename InputIterator, typename>
+	constexpr typename ArrayVector<T, N, Alignment, isConstexpr>::iterator ArrayVector<T, N, Alignment, isConstexpr>::insert(
+		const_iterator it, InputIterator first, InputIterator last
+	) {
+		if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+			typename std::iterator_traits<InputIterator>::iterator_category>
+		) {
+			size_type count = std::distance(first, last);
+			iterator itCopy = begin() + (it - begin());
+
+			size_type numConstructed = shiftTail(itCopy, count);
+			if constexpr (kIsTrivial) {
+				for (size_type i = 0; i < count; ++i, ++first) {
+					itCopy[i] = *first;
+				}
+			}
+			else if constexpr (std::is_trivially_copyable_v<T>) {
+				std::uninitialized_copy_n(first, count, itCopy);
+			}
+			else {
+				for (size_type i = 0; i < count; ++i, ++first) {
+					if (i < numConstructed) {
+						itCopy[i] = *first;
+					}
+					else {
+						new (itCopy + i) T(*first);
+					}
+				}
+			}
+			mNumElements += count;
+
+			return itCopy;
+		}
+		else {
+			// The size of the range is unknown, so the elements are added
+			// at the back and then rotated into place
+			size_type position = it - begin(), oldSize = mNumElements;
+			for (; first != last; ++first) {
+				emplace_back(*first);
+			}
+			std::rotate(begin() + position, begin() + oldSize, end());
+
+			return begin() + position;
+		}
+	}
+
+
+	template <typename T, std::size_t N, std::size_t Alignment, bool isConstexpr>
+	constexpr typename ArrayVector<T, N, Alignment, isConstexpr>::iterator ArrayVector<T, N, Alignment, isConstexpr>::insert(
+		const_iterator it, size_type count, const T& value
+	) {
+		// The value is copied first since it could be stored in the
+		// ArrayVector
+		T valueCopy = value;
+		iterator itCopy = begin() + (it - begin());
+
+		size_type numConstructed = shiftTail(itCopy, count);
+		if constexpr (kIsTrivial) {
+			for (size_type i = 0; i < count; ++i) {
+				itCopy[i] = valueCopy;
+			}
+		}
+		else {
+			std::fill_n(itCopy, numConstructed, valueCopy);
+			std::uninitialized_fill_n(itCopy + numConstructed, count - numConstructed, valueCopy);
+		}
+		mNumElements += count;
+
+		return itCopy;
 	}
 
 
-	template <typename T, std::size_t N>
-	typename ArrayVector<T, N>::iterator ArrayVector<T, N>::erase(const_iterator it)
+	template <typename T, std::size_t N, std::size_t Alignment, bool isConstexpr>
+	constexpr typename ArrayVector<T, N, Alignment, isConstexpr>::iterator ArrayVector<T, N, Alignment, isConstexpr>::erase(const_iterator it)
 	{
-		iterator itCopy = const_cast<iterator>(it);
+		iterator itCopy = begin() + (it - begin());
 
 		if (itCopy != end()) {
-			for (iterator it2 = itCopy + 1; it2 != end(); ++it2) {
-				*(it2 - 1) = std::move(*it2);
+			if constexpr (std::is_trivially_copyable_v<T>) {
+				moveTrivial(itCopy + 1, end(), itCopy);
+				mNumElements--;
+			}
+			else {
+				std::move(itCopy + 1, end(), itCopy);
+				pop_back();
 			}
-			pop_back();
 		}
 
 		return itCopy;
 	}
 
+
+	template <typename T, std::size_t N, std::size_t Alignment, bool isConstexpr>
+	constexpr typename ArrayVector<T, N, Alignment, isConstexpr>::size_type ArrayVector<T, N, Alignment, isConstexpr>::shiftTail(iterator it, size_type count)
+	{
+		size_type numTail = end() - it;
+		if ((count == 0) || (numTail == 0)) {
+			return 0;
+		}
+
+		if constexpr (std::is_trivially_copyable_v<T>) {
+			moveTrivial(it, end(), it + count);
+			return 0;
+		}
+		else {
+			// The last elements are moved to the unconstructed positions
+			// and the remaining ones over the moved-from elements
+			size_type numToRaw = std::min(count, numTail);
+			std::uninitialized_move(end() - numToRaw, end(), end() + count - numToRaw);
+			std::move_backward(it, end() - numToRaw, end() + count - numToRaw);
+			return numToRaw;
+		}
+	}
+
+
+	template <typename T, std::size_t N, std::size_t Alignment, bool isConstexpr>
+	constexpr void ArrayVector<T, N, Alignment, isConstexpr>::moveTrivial(T* first, T* last, T* destination)
+	{
+#ifdef STDEXT_HAS_IS_CONSTANT_EVALUATED
+		if (!isConstantEvaluated()) {
+			if (first != last) {
+				std::memmove(destination, first, (last - first) * sizeof(T));
+			}
+		}
+		else if (destination < first) {
+			for (; first != last; ++first, ++destination) {
+				*destination = *first;
+			}
+		}
+		else {
+			for (destination += last - first; first != last;) {
+				*--destination = *--last;
+			}
+		}
+#else
+		// The constant evaluation can't be detected, so these functions
+		// can't be used in constant expressions
+		if (first != last) {
+			std::memmove(destination, first, (last - first) * sizeof(T));
+		}
+#endif
+	}
+
 }
 
 #endif		// STDEXT_ARRAY_VECTOR_HPP
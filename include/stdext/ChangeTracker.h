@@ -0,0 +1,185 @@
+#ifndef STDEXT_CHANGE_TRACKER_H
+#define STDEXT_CHANGE_TRACKER_H
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+namespace stdext {
+
+	/** The kinds of changes that can be done to an indexed Element */
+	enum class ChangeType { Created, Modified, Released };
+
+
+	/**
+	 * Class ChangeTracker, it records the changes done to the Elements of an
+	 * indexed container in epochs. The epoch is advanced by the user (for
+	 * example once per tick), and later all the Elements changed since a
+	 * given epoch can be retrieved with a cost proportional to the number of
+	 * changes instead of the number of Elements.
+	 */
+	class ChangeTracker
+	{
+	private:	// Nested types
+		/** Struct SlotState, holds the last changes of an Element */
+		struct SlotState
+		{
+			/** The epoch in which the Element was created */
+			std::uint64_t createdEpoch = 0;
+
+			/** The epoch of the last change of the Element */
+			std::uint64_t changedEpoch = 0;
+
+			/** If the last change of the Element was its removal */
+			bool released = true;
+		};
+
+		/** Struct LogEntry, holds an Element changed in an epoch */
+		struct LogEntry
+		{
+			/** The epoch in which the Element was changed */
+			std::uint64_t epoch;
+
+			/** The index of the Element */
+			std::size_t index;
+		};
+
+	private:	// Attributes
+		/** If the changes are being recorded or not */
+		bool mEnabled;
+
+		/** The current epoch */
+		std::uint64_t mEpoch;
+
+		/** The state of each of the changed Elements */
+		std::vector<SlotState> mSlotStates;
+
+		/** The Elements changed, sorted by epoch. An Element is added only
+		 * once per epoch */
+		std::vector<LogEntry> mChangeLog;
+
+	public:		// Functions
+		/** Creates a new ChangeTracker, initially disabled */
+		ChangeTracker() : mEnabled(false), mEpoch(1) {};
+
+		/** @return	true if the changes are being recorded, false otherwise */
+		bool isEnabled() const { return mEnabled; };
+
+		/** Enables or disables the recording of the changes
+		 *
+		 * @param	enabled true if the changes must be recorded, false
+		 *			otherwise
+		 * @note	the changes done while disabled are lost, so the
+		 *			Elements must be fully synchronized after enabling it */
+		void setEnabled(bool enabled) { mEnabled = enabled; };
+
+		/** @return	the current epoch */
+		std::uint64_t getEpoch() const { return mEpoch; };
+
+		/** Advances to the next epoch
+		 *
+		 * @return	the new epoch */
+		std::uint64_t nextEpoch() { return ++mEpoch; };
+
+		/** Records a change of an Element in the current epoch
+		 *
+		 * @param	index the index of the changed Element
+		 * @param	type the kind of change */
+		void notify(std::size_t index, ChangeType type)
+		{ if (mEnabled) { record(index, type); } };
+
+		/** Calls the given function for each Element changed since the given
+		 * epoch (included) with its index and the kind of change
+		 *
+		 * @param	epoch the first epoch whose changes will be retrieved
+		 * @param	f the function to call for each changed Element
+		 * @note	each Element is reported once with its last change. An
+		 *			Element reused since the epoch is reported as
+		 *			ChangeType::Created, and an Element created and removed
+		 *			since the epoch as ChangeType::Released */
+		template <typename F>
+		void forEachChange(std::uint64_t epoch, F&& f) const;
+
+		/** Discards the recorded changes older than the given epoch
+		 *
+		 * @param	epoch the first epoch whose changes will be kept */
+		void discardChanges(std::uint64_t epoch);
+
+		/** Discards all the recorded changes */
+		void clear();
+	private:
+		/** Records a change of an Element in the current epoch
+		 *
+		 * @param	index the index of the changed Element
+		 * @param	type the kind of change */
+		void record(std::size_t index, ChangeType type);
+	};
+
+
+	template <typename F>
+	void ChangeTracker::forEachChange(std::uint64_t epoch, F&& f) const
+	{
+		auto it = std::lower_bound(
+			mChangeLog.begin(), mChangeLog.end(), epoch,
+			[](const LogEntry& entry, std::uint64_t e) { return entry.epoch < e; }
+		);
+
+		for (; it != mChangeLog.end(); ++it) {
+			// Only the last entry of each Element is reported
+			const SlotState& state = mSlotStates[it->index];
+			if (it->epoch == state.changedEpoch) {
+				ChangeType type = state.released? ChangeType::Released
+					: (state.createdEpoch >= epoch)? ChangeType::Created
+					: ChangeType::Modified;
+				f(it->index, type);
+			}
+		}
+	}
+
+
+	inline void ChangeTracker::discardChanges(std::uint64_t epoch)
+	{
+		auto it = std::lower_bound(
+			mChangeLog.begin(), mChangeLog.end(), epoch,
+			[](const LogEntry& entry, std::uint64_t e) { return entry.epoch < e; }
+		);
+		mChangeLog.erase(mChangeLog.begin(), it);
+	}
+
+
+	inline void ChangeTracker::clear()
+	{
+		mSlotStates.clear();
+		mChangeLog.clear();
+	}
+
+
+	inline void ChangeTracker::record(std::size_t index, ChangeType type)
+	{
+		if (index >= mSlotStates.size()) {
+			mSlotStates.resize(index + 1);
+		}
+
+		SlotState& state = mSlotStates[index];
+		if (state.changedEpoch != mEpoch) {
+			mChangeLog.push_back({ mEpoch, index });
+			state.changedEpoch = mEpoch;
+		}
+
+		switch (type) {
+			case ChangeType::Created:
+				state.createdEpoch = mEpoch;
+				state.released = false;
+				break;
+			case ChangeType::Modified:
+				state.released = false;
+				break;
+			case ChangeType::Released:
+				state.released = true;
+				break;
+		}
+	}
+
+}
+
+#endif		// STDEXT_CHANGE_TRACKER_H
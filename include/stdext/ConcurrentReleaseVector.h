@@ -0,0 +1,206 @@
+#ifndef STDEXT_CONCURRENT_RELEASE_VECTOR_H
+#define STDEXT_CONCURRENT_RELEASE_VECTOR_H
+
+#include <mutex>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace stdext {
+
+	/**
+	 * Class ConcurrentReleaseVector, it's a ReleaseVector of elements of
+	 * type @tparam T that can be modified from multiple threads at the same
+	 * time. The Elements are stored in blocks of increasing size that are
+	 * never moved, so the growth of the vector doesn't invalidate the
+	 * pointers nor blocks the threads that are reading the already created
+	 * Elements. New indices are claimed atomically and the released ones are
+	 * distributed between multiple free lists, so the threads that create and
+	 * remove Elements at the same time rarely compete for the same lock. All
+	 * the memory allocation will be done using the allocator @tparam A.
+	 *
+	 * @note	the Elements themselves aren't protected, so an Element
+	 *			mustn't be accessed while other thread is removing it
+	 */
+	template <typename T, typename A = std::allocator<T>>
+	class ConcurrentReleaseVector
+	{
+	public:		// Nested types
+		using size_type		= std::size_t;
+		using value_type	= T;
+		using pointer		= T*;
+		using reference		= T&;
+
+	private:
+		/** Struct Slot, holds an Element of the ConcurrentReleaseVector */
+		struct Slot
+		{
+			/** If the Element of the Slot is constructed or not */
+			std::atomic<bool> active{ false };
+
+			/** The memory where the Element is stored */
+			alignas(T) std::byte storage[sizeof(T)];
+		};
+
+		/** Struct FreeList, holds some of the released indices of the
+		 * ConcurrentReleaseVector */
+		struct alignas(64) FreeList
+		{
+			/** The mutex used for protecting @see indices */
+			std::mutex mutex;
+
+			/** The released indices */
+			std::vector<size_type> indices;
+		};
+
+		using SlotAllocator =
+			typename std::allocator_traits<A>::template rebind_alloc<Slot>;
+
+		/** The number of Slots of the first block, the size of the following
+		 * ones is doubled each time */
+		static constexpr size_type kFirstBlockSize = 64;
+
+		/** The log2 of @see kFirstBlockSize */
+		static constexpr size_type kFirstBlockSizeLog2 = 6;
+
+		/** The maximum number of blocks */
+		static constexpr size_type kMaxBlocks =
+			8 * sizeof(size_type) - kFirstBlockSizeLog2;
+
+		/** The number of free lists between which the released indices are
+		 * distributed */
+		static constexpr size_type kNumFreeLists = 16;
+
+	private:	// Attributes
+		/** The blocks of Slots of the ConcurrentReleaseVector, the block i
+		 * has @see kFirstBlockSize * 2^i Slots */
+		std::atomic<Slot*> mBlocks[kMaxBlocks];
+
+		/** The index of the past-the-end Element of the
+		 * ConcurrentReleaseVector */
+		std::atomic<size_type> mEndIndex;
+
+		/** The number of Elements in the ConcurrentReleaseVector */
+		std::atomic<size_type> mSize;
+
+		/** The number of indices stored in all the free lists */
+		std::atomic<size_type> mNumReleased;
+
+		/** The free lists with the released indices. Each thread pushes the
+		 * indices to a different one */
+		FreeList mFreeLists[kNumFreeLists];
+
+		/** The allocator used for creating the blocks of Slots */
+		SlotAllocator mAllocator;
+
+	public:		// Functions
+		/** Creates a new ConcurrentReleaseVector */
+		ConcurrentReleaseVector();
+		ConcurrentReleaseVector(const ConcurrentReleaseVector& other) = delete;
+
+		/** Class destructor */
+		~ConcurrentReleaseVector();
+
+		/** Assignment operator */
+		ConcurrentReleaseVector& operator=(
+			const ConcurrentReleaseVector& other
+		) = delete;
+
+		/** Returns the Element i of the ConcurrentReleaseVector
+		 *
+		 * @param	i the index of the Element
+		 * @return	a reference to the Element */
+		T& operator[](size_type i)
+		{ return *reinterpret_cast<T*>(getSlot(i).storage); };
+
+		/** Returns the Element i of the ConcurrentReleaseVector
+		 *
+		 * @param	i the index of the Element
+		 * @return	a const reference to the Element */
+		const T& operator[](size_type i) const
+		{ return *reinterpret_cast<const T*>(getSlot(i).storage); };
+
+		/** @return	the number of Elements in the ConcurrentReleaseVector */
+		size_type size() const { return mSize.load(); };
+
+		/** @return	true if the ConcurrentReleaseVector has no Elements
+		 *			inside, false otherwise */
+		bool empty() const { return (size() == 0); };
+
+		/** @return	the index of the past-the-end Element of the
+		 *			ConcurrentReleaseVector */
+		size_type endIndex() const { return mEndIndex.load(); };
+
+		/** Removes all the elements in the ConcurrentReleaseVector
+		 * @note	it must not be called concurrently with any other
+		 *			function */
+		void clear();
+
+		/** Creates a new Element in the vector or reuses an already released
+		 * one
+		 *
+		 * @param	args the arguments needed for calling the constructor of
+		 *			the new Element
+		 * @return	the index of the Element */
+		template <typename... Args>
+		size_type emplace(Args&&... args);
+
+		/** Removes the element located at the given index from the
+		 * ConcurrentReleaseVector
+		 *
+		 * @param	i the index of the Element
+		 * @return	true if the Element was removed, false if it wasn't
+		 *			active */
+		bool erase(size_type i);
+
+		/** Checks if the Element given located at the given index is valid and
+		 * active
+		 *
+		 * @param	i the index of the Element
+		 * @return	true if is valid and active false otherwise */
+		bool isActive(size_type i) const;
+
+		/** Calls the given function for each active Element of the
+		 * ConcurrentReleaseVector
+		 *
+		 * @param	f the function to call. It can receive the index of the
+		 *			Element and the Element, or only the Element
+		 * @note	Elements created during the iteration could be skipped */
+		template <typename F>
+		void forEach(F&& f);
+	private:
+		/** Calculates the block and the position inside it of the given
+		 * index
+		 *
+		 * @param	i the index of the Element
+		 * @param	block the block where the Element is located (return)
+		 * @param	offset the position of the Element inside the block
+		 *			(return) */
+		static void locate(size_type i, size_type& block, size_type& offset);
+
+		/** @return	the Slot of the Element i
+		 * @note	the block of the Slot must be already allocated */
+		Slot& getSlot(size_type i) const;
+
+		/** Allocates the block with the given index if it wasn't already
+		 * allocated
+		 *
+		 * @param	block the index of the block */
+		void allocateBlock(size_type block);
+
+		/** @return	the free list that the current thread must use */
+		FreeList& getThreadFreeList();
+
+		/** Pops a released index from the free lists
+		 *
+		 * @param	index the released index (return)
+		 * @return	true if a released index was found, false otherwise */
+		bool popReleasedIndex(size_type& index);
+	};
+
+}
+
+#include "ConcurrentReleaseVector.hpp"
+
+#endif		// STDEXT_CONCURRENT_RELEASE_VECTOR_H
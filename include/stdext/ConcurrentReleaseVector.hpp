@@ -0,0 +1,244 @@
+#ifndef STDEXT_CONCURRENT_RELEASE_VECTOR_HPP
+#define STDEXT_CONCURRENT_RELEASE_VECTOR_HPP
+
+#include <type_traits>
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+
+namespace stdext {
+
+	template <typename T, typename A>
+	ConcurrentReleaseVector<T, A>::ConcurrentReleaseVector() :
+		mEndIndex(0), mSize(0), mNumReleased(0)
+	{
+		for (auto& block : mBlocks) {
+			block.store(nullptr);
+		}
+	}
+
+
+	template <typename T, typename A>
+	ConcurrentReleaseVector<T, A>::~ConcurrentReleaseVector()
+	{
+		clear();
+
+		for (size_type i = 0; i < kMaxBlocks; ++i) {
+			Slot* block = mBlocks[i].load();
+			if (block) {
+				size_type blockSize = kFirstBlockSize << i;
+				std::destroy_n(block, blockSize);
+				mAllocator.deallocate(block, blockSize);
+			}
+		}
+	}
+
+
+	template <typename T, typename A>
+	void ConcurrentReleaseVector<T, A>::clear()
+	{
+		size_type endIndex = mEndIndex.load();
+		for (size_type i = 0; i < endIndex; ++i) {
+			Slot& slot = getSlot(i);
+			if (slot.active.load()) {
+				reinterpret_cast<T*>(slot.storage)->~T();
+				slot.active.store(false);
+			}
+		}
+
+		for (FreeList& freeList : mFreeLists) {
+			freeList.indices.clear();
+		}
+
+		mEndIndex.store(0);
+		mSize.store(0);
+		mNumReleased.store(0);
+	}
+
+
+	template <typename T, typename A>
+	template <typename... Args>
+	typename ConcurrentReleaseVector<T, A>::size_type ConcurrentReleaseVector<T, A>::emplace(Args&&... args)
+	{
+		size_type index;
+		if (!popReleasedIndex(index)) {
+			index = mEndIndex.fetch_add(1);
+
+			size_type block, offset;
+			locate(index, block, offset);
+			allocateBlock(block);
+		}
+
+		Slot& slot = getSlot(index);
+		new (slot.storage) T(std::forward<Args>(args)...);
+		slot.active.store(true, std::memory_order_release);
+		mSize.fetch_add(1, std::memory_order_relaxed);
+
+		return index;
+	}
+
+
+	template <typename T, typename A>
+	bool ConcurrentReleaseVector<T, A>::erase(size_type i)
+	{
+		if (!isActive(i)) {
+			return false;
+		}
+
+		// Only one of the threads that try to remove the Element will succeed
+		Slot& slot = getSlot(i);
+		if (!slot.active.exchange(false, std::memory_order_acq_rel)) {
+			return false;
+		}
+
+		reinterpret_cast<T*>(slot.storage)->~T();
+		mSize.fetch_sub(1, std::memory_order_relaxed);
+
+		FreeList& freeList = getThreadFreeList();
+		{
+			std::scoped_lock lock(freeList.mutex);
+			freeList.indices.push_back(i);
+		}
+		mNumReleased.fetch_add(1, std::memory_order_release);
+
+		return true;
+	}
+
+
+	template <typename T, typename A>
+	bool ConcurrentReleaseVector<T, A>::isActive(size_type i) const
+	{
+		size_type block, offset;
+		locate(i, block, offset);
+		if (block >= kMaxBlocks) {
+			return false;
+		}
+
+		Slot* slots = mBlocks[block].load(std::memory_order_acquire);
+		return slots && slots[offset].active.load(std::memory_order_acquire);
+	}
+
+
+	template <typename T, typename A>
+	template <typename F>
+	void ConcurrentReleaseVector<T, A>::forEach(F&& f)
+	{
+		size_type endIndex = mEndIndex.load(std::memory_order_acquire);
+		for (size_type i = 0; i < endIndex; ++i) {
+			if (isActive(i)) {
+				if constexpr (std::is_invocable_v<F, size_type, T&>) {
+					f(i, (*this)[i]);
+				}
+				else {
+					f((*this)[i]);
+				}
+			}
+		}
+	}
+
+
+	template <typename T, typename A>
+	void ConcurrentReleaseVector<T, A>::locate(size_type i, size_type& block, size_type& offset)
+	{
+		// The blocks are sized so (i + kFirstBlockSize) has its highest bit
+		// at the position (block + kFirstBlockSizeLog2)
+		size_type shifted = i + kFirstBlockSize;
+		if (shifted < i) {
+			block = kMaxBlocks;
+			return;
+		}
+
+		size_type highestBit;
+#if defined(__GNUC__) || defined(__clang__)
+		highestBit = 8 * sizeof(unsigned long long) - 1
+			- __builtin_clzll(static_cast<unsigned long long>(shifted));
+#elif defined(_MSC_VER) && defined(_WIN64)
+		unsigned long bit;
+		_BitScanReverse64(&bit, shifted);
+		highestBit = bit;
+#else
+		highestBit = 0;
+		for (size_type value = shifted; value > 1; value >>= 1) {
+			++highestBit;
+		}
+#endif
+
+		block = highestBit - kFirstBlockSizeLog2;
+		offset = shifted - (size_type(1) << highestBit);
+	}
+
+
+	template <typename T, typename A>
+	typename ConcurrentReleaseVector<T, A>::Slot& ConcurrentReleaseVector<T, A>::getSlot(size_type i) const
+	{
+		size_type block, offset;
+		locate(i, block, offset);
+		return mBlocks[block].load(std::memory_order_acquire)[offset];
+	}
+
+
+	template <typename T, typename A>
+	void ConcurrentReleaseVector<T, A>::allocateBlock(size_type block)
+	{
+		if (mBlocks[block].load(std::memory_order_acquire)) {
+			return;
+		}
+
+		size_type blockSize = kFirstBlockSize << block;
+		Slot* slots = mAllocator.allocate(blockSize);
+		std::uninitialized_default_construct_n(slots, blockSize);
+
+		// If other thread allocated the block first, ours is discarded
+		Slot* expected = nullptr;
+		if (!mBlocks[block].compare_exchange_strong(expected, slots, std::memory_order_acq_rel)) {
+			std::destroy_n(slots, blockSize);
+			mAllocator.deallocate(slots, blockSize);
+		}
+	}
+
+
+	template <typename T, typename A>
+	typename ConcurrentReleaseVector<T, A>::FreeList& ConcurrentReleaseVector<T, A>::getThreadFreeList()
+	{
+		static std::atomic<size_type> sNextFreeList = 0;
+		static thread_local size_type sThreadFreeList = sNextFreeList.fetch_add(1) % kNumFreeLists;
+		return mFreeLists[sThreadFreeList];
+	}
+
+
+	template <typename T, typename A>
+	bool ConcurrentReleaseVector<T, A>::popReleasedIndex(size_type& index)
+	{
+		if (mNumReleased.load(std::memory_order_acquire) == 0) {
+			return false;
+		}
+
+		// The free list of the current thread is tried first, then the others
+		// are visited without waiting for their locks
+		FreeList& threadFreeList = getThreadFreeList();
+		size_type iFirst = &threadFreeList - mFreeLists;
+		for (size_type i = 0; i < kNumFreeLists; ++i) {
+			FreeList& freeList = mFreeLists[(iFirst + i) % kNumFreeLists];
+
+			std::unique_lock lock(freeList.mutex, std::defer_lock);
+			if (i == 0) {
+				lock.lock();
+			}
+			else if (!lock.try_lock()) {
+				continue;
+			}
+
+			if (!freeList.indices.empty()) {
+				index = freeList.indices.back();
+				freeList.indices.pop_back();
+				mNumReleased.fetch_sub(1, std::memory_order_relaxed);
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+}
+
+#endif		// STDEXT_CONCURRENT_RELEASE_VECTOR_HPP
@@ -0,0 +1,82 @@
+#ifndef STDEXT_MAPPED_FILE_H
+#define STDEXT_MAPPED_FILE_H
+
+#include <cstddef>
+
+namespace stdext {
+
+	/**
+	 * Class MappedFile, it maps the contents of a file into memory, so it can
+	 * be read without copying it. The mapping can be read only or copy on
+	 * write, in which case the modified pages will be copied by the operating
+	 * system on their first write, and the changes won't be written back to
+	 * the file.
+	 */
+	class MappedFile
+	{
+	public:		// Nested types
+		/** The access modes of the mapped memory */
+		enum class Mode { ReadOnly, CopyOnWrite };
+
+	private:	// Attributes
+		/** A pointer to the mapped memory */
+		std::byte* mData;
+
+		/** The size in bytes of the mapped memory */
+		std::size_t mSize;
+
+		/** The access mode of the mapped memory */
+		Mode mMode;
+
+#ifdef _WIN32
+		/** The handle to the mapped file */
+		void* mFileHandle;
+
+		/** The handle to the file mapping object */
+		void* mMappingHandle;
+#endif
+
+	public:		// Functions
+		/** Creates a new MappedFile without any file mapped */
+		MappedFile();
+		MappedFile(const MappedFile& other) = delete;
+		MappedFile(MappedFile&& other);
+
+		/** Class destructor. It unmaps the file */
+		~MappedFile();
+
+		/** Assignment operator */
+		MappedFile& operator=(const MappedFile& other) = delete;
+		MappedFile& operator=(MappedFile&& other);
+
+		/** Maps the given file into memory, unmapping the previous one
+		 *
+		 * @param	path the path of the file to map
+		 * @param	mode the access mode of the mapped memory
+		 * @return	true if the file was mapped, false otherwise
+		 * @note	empty files can't be mapped */
+		bool open(const char* path, Mode mode = Mode::ReadOnly);
+
+		/** Unmaps the current file */
+		void close();
+
+		/** @return	true if there is a file mapped, false otherwise */
+		bool isOpen() const { return mData != nullptr; };
+
+		/** @return	the access mode of the mapped memory */
+		Mode getMode() const { return mMode; };
+
+		/** @return	a pointer to the mapped memory
+		 * @note	it can only be written with Mode::CopyOnWrite */
+		std::byte* data() { return mData; };
+
+		/** @return	a pointer to the mapped memory */
+		const std::byte* data() const { return mData; };
+
+		/** @return	the size in bytes of the mapped memory */
+		std::size_t size() const { return mSize; };
+	};
+
+}
+
+#endif		// STDEXT_MAPPED_FILE_H
@@ -0,0 +1,152 @@
+#ifndef STDEXT_MEMORY_REGISTRY_H
+#define STDEXT_MEMORY_REGISTRY_H
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <functional>
+#include <unordered_map>
+#include "MemoryStats.h"
+
+namespace stdext {
+
+	/**
+	 * Class MemoryRegistry, it's a global registry of containers used for
+	 * aggregating their MemoryStats by container type. The containers aren't
+	 * registered automatically, only the ones added by the user are tracked.
+	 * It can be used from multiple threads: the MemoryStats of each container
+	 * are only retrieved by the thread that owns it, when it's registered and
+	 * each time its Registration is updated, and the queries aggregate those
+	 * snapshots.
+	 */
+	class MemoryRegistry
+	{
+	public:		// Nested types
+		/**
+		 * Class Registration, it keeps a container registered in the
+		 * MemoryRegistry until it's destroyed
+		 */
+		class Registration
+		{
+		private:	// Attributes
+			/** The MemoryRegistry where the container is registered */
+			MemoryRegistry* mRegistry;
+
+			/** The id of the container in the MemoryRegistry */
+			std::size_t mId;
+
+		public:		// Functions
+			/** Creates a new Registration
+			 *
+			 * @param	registry the MemoryRegistry where the container is
+			 *			registered
+			 * @param	id the id of the container in the MemoryRegistry */
+			Registration(MemoryRegistry* registry = nullptr, std::size_t id = 0) :
+				mRegistry(registry), mId(id) {};
+			Registration(const Registration& other) = delete;
+			Registration(Registration&& other);
+
+			/** Class destructor, unregisters the container */
+			~Registration() { reset(); };
+
+			/** Assignment operator */
+			Registration& operator=(const Registration& other) = delete;
+			Registration& operator=(Registration&& other);
+
+			/** Unregisters the container */
+			void reset();
+
+			/** Updates the snapshot of the MemoryStats of the container
+			 * that is returned by the queries to the MemoryRegistry
+			 *
+			 * @note	it must be called from the thread that owns the
+			 *			container */
+			void update();
+		};
+
+	private:
+		/** Struct Entry, holds a registered container */
+		struct Entry
+		{
+			/** The name of the type of the container */
+			std::string typeName;
+
+			/** The function used for retrieving the MemoryStats of the
+			 * container */
+			std::function<MemoryStats()> getStats;
+
+			/** The MemoryStats of the container at its last update */
+			MemoryStats stats;
+		};
+
+	private:	// Attributes
+		/** The mutex used for protecting the registered containers */
+		mutable std::mutex mMutex;
+
+		/** The registered containers mapped by their ids */
+		std::unordered_map<std::size_t, Entry> mEntries;
+
+		/** The id of the next registered container */
+		std::size_t mNextId;
+
+	public:		// Functions
+		/** Creates a new MemoryRegistry */
+		MemoryRegistry() : mNextId(1) {};
+
+		/** @return	the global MemoryRegistry */
+		static MemoryRegistry& getInstance();
+
+		/** Registers the given container
+		 *
+		 * @param	typeName the name of the type of the container, the
+		 *			containers with the same name are aggregated together
+		 * @param	container the container to register. It must have a
+		 *			getMemoryStats function
+		 * @return	the Registration that keeps the container registered
+		 * @note	the container mustn't be moved nor destroyed while it's
+		 *			registered. It must be called from the thread that owns
+		 *			the container */
+		template <typename C>
+		Registration add(std::string typeName, const C& container)
+		{
+			return addStatsFunction(std::move(typeName), [&container]() {
+				return container.getMemoryStats();
+			});
+		}
+
+		/** Registers a container with the given function
+		 *
+		 * @param	typeName the name of the type of the container, the
+		 *			containers with the same name are aggregated together
+		 * @param	getStats the function used for retrieving the MemoryStats
+		 *			of the container. It's only called by this function and
+		 *			by Registration::update
+		 * @return	the Registration that keeps the container registered */
+		Registration addStatsFunction(
+			std::string typeName, std::function<MemoryStats()> getStats
+		);
+
+		/** @return	the MemoryStats of all the registered containers
+		 *			aggregated by the name of their type, as they were at
+		 *			their last update */
+		std::map<std::string, MemoryStats> getStatsByType() const;
+
+		/** @return	the MemoryStats of all the registered containers, as
+		 *			they were at their last update */
+		MemoryStats getTotalStats() const;
+	private:
+		/** Updates the snapshot of the MemoryStats of the container with
+		 * the given id
+		 *
+		 * @param	id the id of the container */
+		void update(std::size_t id);
+
+		/** Unregisters the container with the given id
+		 *
+		 * @param	id the id of the container */
+		void remove(std::size_t id);
+	};
+
+}
+
+#endif		// STDEXT_MEMORY_REGISTRY_H
@@ -0,0 +1,64 @@
+#ifndef STDEXT_MEMORY_STATS_H
+#define STDEXT_MEMORY_STATS_H
+
+#include <cstddef>
+
+namespace stdext {
+
+	/**
+	 * Struct MemoryStats, holds the memory used by a container. It's used
+	 * for deciding when to compact the containers and for detecting memory
+	 * regressions.
+	 */
+	struct MemoryStats
+	{
+		/** The number of memory blocks allocated by the container */
+		std::size_t numAllocations = 0;
+
+		/** The number of bytes reserved by the container */
+		std::size_t reservedBytes = 0;
+
+		/** The number of bytes used by the Elements of the container */
+		std::size_t liveBytes = 0;
+
+		/** The number of Elements in the container */
+		std::size_t numElements = 0;
+
+		/** The number of released Elements located between the active ones,
+		 * that can't be used until they are reused */
+		std::size_t numHoles = 0;
+
+		/** @return	the ratio of holes to the total number of slots (holes +
+		 *			Elements), 0 if there are no slots */
+		double getHoleRatio() const
+		{
+			std::size_t numSlots = numElements + numHoles;
+			return (numSlots > 0)? static_cast<double>(numHoles) / numSlots : 0.0;
+		};
+
+		/** @return	the ratio of reserved bytes that aren't used by the
+		 *			Elements, 0 if there are no reserved bytes */
+		double getFragmentation() const
+		{
+			return (reservedBytes > 0)?
+				1.0 - static_cast<double>(liveBytes) / reservedBytes : 0.0;
+		};
+
+		/** Adds the given MemoryStats to the current ones
+		 *
+		 * @param	other the MemoryStats to add
+		 * @return	a reference to the current MemoryStats */
+		MemoryStats& operator+=(const MemoryStats& other)
+		{
+			numAllocations += other.numAllocations;
+			reservedBytes += other.reservedBytes;
+			liveBytes += other.liveBytes;
+			numElements += other.numElements;
+			numHoles += other.numHoles;
+			return *this;
+		};
+	};
+
+}
+
+#endif		// STDEXT_MEMORY_STATS_H
@@ -0,0 +1,131 @@
+#ifndef STDEXT_PARALLEL_UTILS_H
+#define STDEXT_PARALLEL_UTILS_H
+
+#include <vector>
+#include <future>
+#include <exception>
+#include <algorithm>
+#include <type_traits>
+#include "ThreadPool.h"
+#include "ReleaseVector.h"
+
+namespace stdext {
+
+	/** Calls the given function for each active Element of the given
+	 * ReleaseVector in parallel. The indices of the ReleaseVector are split
+	 * in chunks with the same number of active Elements, and each chunk is
+	 * iterated by a different thread skipping the released Elements without
+	 * searching them
+	 *
+	 * @param	pool the ThreadPool used for iterating the chunks. One of the
+	 *			chunks is iterated by the calling thread
+	 * @param	vector the (const) ReleaseVector to iterate
+	 * @param	f the function to call. It can receive the index of the
+	 *			Element and the Element, or only the Element. It will be
+	 *			called concurrently, so it must be thread safe
+	 * @param	numChunks the number of chunks in which the vector will be
+	 *			split. If it's 0, one chunk per thread of the pool plus
+	 *			the calling one will be used
+	 * @note	the ReleaseVector mustn't be modified until the function
+	 *			returns. If it's called from one of the threads of the
+	 *			pool, all the chunks are iterated by the calling thread */
+	template <typename V, typename F>
+	void parallelForEach(
+		ThreadPool& pool, V& vector, F&& f, std::size_t numChunks = 0
+	) {
+		using size_type = std::size_t;
+
+		size_type endIndex = vector.end().getIndex();
+		std::vector<size_type> released(
+			vector.releasedIndices(),
+			vector.releasedIndices() + vector.numReleasedIndices()
+		);
+		std::sort(released.begin(), released.end());
+
+		size_type numActive = endIndex - released.size();
+		if (numChunks == 0) {
+			numChunks = pool.getNumThreads() + 1;
+		}
+		if (pool.isPoolThread()) {
+			// Waiting for the chunks from a thread of the pool could
+			// deadlock once all of its threads are waiting
+			numChunks = 1;
+		}
+		numChunks = std::min(numChunks, numActive);
+		if (numChunks == 0) {
+			return;
+		}
+
+		// The number of active Elements before the released index k is
+		// (released[k] - k), so the position of the active Element with the
+		// given rank can be found with a binary search
+		auto getChunkStart = [&](size_type iChunk, size_type& iReleased) {
+			size_type rank = numActive * iChunk / numChunks;
+			iReleased = 0;
+			size_type count = released.size();
+			while (count > 0) {
+				size_type step = count / 2;
+				if (released[iReleased + step] - (iReleased + step) <= rank) {
+					iReleased += step + 1;
+					count -= step + 1;
+				}
+				else {
+					count = step;
+				}
+			}
+			return (iChunk < numChunks)? rank + iReleased : endIndex;
+		};
+
+		auto iterateChunk = [&](size_type iChunk) {
+			size_type iReleased, iReleasedEnd;
+			size_type first = getChunkStart(iChunk, iReleased);
+			size_type last = getChunkStart(iChunk + 1, iReleasedEnd);
+
+			for (size_type i = first; i < last; ++i) {
+				if ((iReleased < iReleasedEnd) && (released[iReleased] == i)) {
+					++iReleased;
+				}
+				else if constexpr (std::is_invocable_v<F, size_type, decltype(vector[i])>) {
+					f(i, vector[i]);
+				}
+				else {
+					f(vector[i]);
+				}
+			}
+		};
+
+		std::vector<std::future<void>> futures;
+		futures.reserve(numChunks - 1);
+		for (size_type iChunk = 0; iChunk + 1 < numChunks; ++iChunk) {
+			futures.push_back( pool.async([&, iChunk]() { iterateChunk(iChunk); }) );
+		}
+
+		// All the chunks must finish before rethrowing any exception, since
+		// they reference the local variables
+		std::exception_ptr error;
+		try {
+			iterateChunk(numChunks - 1);
+		}
+		catch (...) {
+			error = std::current_exception();
+		}
+
+		for (auto& future : futures) {
+			try {
+				future.get();
+			}
+			catch (...) {
+				if (!error) {
+					error = std::current_exception();
+				}
+			}
+		}
+
+		if (error) {
+			std::rethrow_exception(error);
+		}
+	}
+
+}
+
+#endif		// STDEXT_PARALLEL_UTILS_H
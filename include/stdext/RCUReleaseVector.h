@@ -0,0 +1,230 @@
+#ifndef STDEXT_RCU_RELEASE_VECTOR_H
+#define STDEXT_RCU_RELEASE_VECTOR_H
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include "ReleaseVector.h"
+
+namespace stdext {
+
+	/**
+	 * Class RCUReleaseVector, it's a ReleaseVector of elements of type
+	 * @tparam T that can be read from multiple threads while other thread
+	 * modifies it, without blocking any of them. The writer thread modifies
+	 * a working copy of the vector and publishes immutable versions of it,
+	 * and the reader threads access the last published version through
+	 * snapshots that can be taken without waiting for other threads. The old
+	 * versions are reclaimed once there are no readers left that could be
+	 * using them (epoch based reclamation). All the memory allocation of the
+	 * Elements will be done using the allocator @tparam A.
+	 *
+	 * @note	there must be only one writer thread at the same time
+	 */
+	template <typename T, typename A = std::allocator<T>>
+	class RCUReleaseVector
+	{
+	public:		// Nested types
+		using size_type		= std::size_t;
+		using value_type	= T;
+		using VectorType	= ReleaseVector<T, A>;
+
+	private:
+		/** Struct ReaderSlot, holds the epoch in which a reader entered to
+		 * read the published version. Each ReaderSlot is placed in its own
+		 * cache line so the readers don't compete for it */
+		struct alignas(64) ReaderSlot
+		{
+			/** The epoch in which the reader took its snapshot, or
+			 * @see kInactive if it isn't reading */
+			std::atomic<std::uint64_t> epoch;
+
+			/** If the ReaderSlot is being used by a Reader */
+			std::atomic<bool> used;
+
+			/** The next ReaderSlot of the list */
+			ReaderSlot* next;
+		};
+
+		/** Struct RetiredVersion, holds a version that has been replaced but
+		 * could still be in use by the readers */
+		struct RetiredVersion
+		{
+			/** The retired version */
+			std::unique_ptr<VectorType> version;
+
+			/** The last epoch in which the version was published */
+			std::uint64_t epoch;
+		};
+
+		/** The epoch of the ReaderSlots that aren't reading */
+		static constexpr std::uint64_t kInactive = UINT64_MAX;
+
+	public:
+		class Reader;
+
+		/**
+		 * Class Snapshot, it gives read access to a published version of the
+		 * RCUReleaseVector. The version won't be reclaimed while the Snapshot
+		 * is alive.
+		 */
+		class Snapshot
+		{
+		private:	// Attributes
+			/** The Reader that took the Snapshot */
+			Reader* mReader;
+
+			/** The version of the RCUReleaseVector */
+			const VectorType* mVersion;
+
+		public:		// Functions
+			/** Creates a new Snapshot
+			 *
+			 * @param	reader the Reader that took the Snapshot
+			 * @param	version the version of the RCUReleaseVector */
+			Snapshot(Reader* reader, const VectorType* version) :
+				mReader(reader), mVersion(version) {};
+			Snapshot(const Snapshot& other) = delete;
+			Snapshot(Snapshot&& other) :
+				mReader(other.mReader), mVersion(other.mVersion)
+			{ other.mReader = nullptr; other.mVersion = nullptr; };
+
+			/** Class destructor, releases the version */
+			~Snapshot() { if (mReader) { mReader->leave(); } };
+
+			/** Assignment operator */
+			Snapshot& operator=(const Snapshot& other) = delete;
+			Snapshot& operator=(Snapshot&& other) = delete;
+
+			/** @return	the version of the RCUReleaseVector */
+			const VectorType& get() const { return *mVersion; };
+
+			/** @return	the version of the RCUReleaseVector */
+			const VectorType& operator*() const { return *mVersion; };
+
+			/** @return	a pointer to the version of the RCUReleaseVector */
+			const VectorType* operator->() const { return mVersion; };
+		};
+
+		/**
+		 * Class Reader, it's the handle used by a reader thread for taking
+		 * Snapshots of a RCUReleaseVector. Each reader thread must have its
+		 * own Reader, that must be destroyed before the RCUReleaseVector.
+		 */
+		class Reader
+		{
+		private:	// Attributes
+			/** The RCUReleaseVector to read */
+			RCUReleaseVector* mParent;
+
+			/** The ReaderSlot of the Reader */
+			ReaderSlot* mSlot;
+
+			/** The number of Snapshots of the Reader that are alive */
+			size_type mNumSnapshots;
+
+		public:		// Functions
+			/** Creates a new Reader
+			 *
+			 * @param	parent the RCUReleaseVector to read
+			 * @param	slot the ReaderSlot of the Reader */
+			Reader(RCUReleaseVector* parent, ReaderSlot* slot) :
+				mParent(parent), mSlot(slot), mNumSnapshots(0) {};
+			Reader(const Reader& other) = delete;
+			Reader(Reader&& other) :
+				mParent(other.mParent), mSlot(other.mSlot),
+				mNumSnapshots(other.mNumSnapshots)
+			{ other.mSlot = nullptr; };
+
+			/** Class destructor, unregisters the Reader */
+			~Reader() { if (mSlot) { mSlot->used.store(false); } };
+
+			/** Assignment operator */
+			Reader& operator=(const Reader& other) = delete;
+			Reader& operator=(Reader&& other) = delete;
+
+			/** Takes a Snapshot of the last published version of the
+			 * RCUReleaseVector, without waiting for the other threads
+			 *
+			 * @return	the new Snapshot
+			 * @note	the Reader mustn't be moved while its Snapshots are
+			 *			alive */
+			Snapshot read();
+		private:
+			/** Releases one of the Snapshots of the Reader */
+			void leave();
+
+			friend class Snapshot;
+		};
+
+	private:	// Attributes
+		/** The last published version */
+		std::atomic<VectorType*> mPublished;
+
+		/** The current epoch, incremented with each published version */
+		std::atomic<std::uint64_t> mEpoch;
+
+		/** The list of ReaderSlots. They are reused by the new Readers and
+		 * only deleted with the RCUReleaseVector */
+		std::atomic<ReaderSlot*> mReaderSlots;
+
+		/** The copy of the vector modified by the writer thread */
+		VectorType mWorkingCopy;
+
+		/** The versions that could be still in use by the readers */
+		std::vector<RetiredVersion> mRetiredVersions;
+
+		/** The reclaimed versions, reused for publishing the following ones
+		 * without allocating their memory again */
+		std::vector<std::unique_ptr<VectorType>> mFreeVersions;
+
+	public:		// Functions
+		/** Creates a new RCUReleaseVector with an empty published version */
+		RCUReleaseVector();
+		RCUReleaseVector(const RCUReleaseVector& other) = delete;
+
+		/** Class destructor
+		 * @note	all the Readers must have been destroyed */
+		~RCUReleaseVector();
+
+		/** Assignment operator */
+		RCUReleaseVector& operator=(const RCUReleaseVector& other) = delete;
+
+		/** Registers a new reader thread, reusing the ReaderSlots of the
+		 * destroyed Readers if possible. It's lock free
+		 *
+		 * @return	the Reader of the thread */
+		Reader createReader();
+
+		/** @return	the copy of the vector that the writer thread can
+		 *			modify. The changes won't be visible to the readers until
+		 *			@see publish is called */
+		VectorType& getWorkingCopy() { return mWorkingCopy; };
+
+		/** @return	the copy of the vector that the writer thread can
+		 *			modify */
+		const VectorType& getWorkingCopy() const { return mWorkingCopy; };
+
+		/** Publishes a copy of the working copy, so the following Snapshots
+		 * will see it, and reclaims the old versions that aren't in use
+		 * @note	it must be called only from the writer thread */
+		void publish();
+
+		/** Reclaims the old versions that aren't in use by any reader
+		 *
+		 * @return	the number of versions reclaimed
+		 * @note	it must be called only from the writer thread */
+		size_type reclaim();
+
+		/** @return	the number of old versions that are waiting to be
+		 *			reclaimed */
+		size_type numRetiredVersions() const
+		{ return mRetiredVersions.size(); };
+	};
+
+}
+
+#include "RCUReleaseVector.hpp"
+
+#endif		// STDEXT_RCU_RELEASE_VECTOR_H
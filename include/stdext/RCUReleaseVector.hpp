@@ -0,0 +1,124 @@
+#ifndef STDEXT_RCU_RELEASE_VECTOR_HPP
+#define STDEXT_RCU_RELEASE_VECTOR_HPP
+
+#include <algorithm>
+
+namespace stdext {
+
+	template <typename T, typename A>
+	typename RCUReleaseVector<T, A>::Snapshot RCUReleaseVector<T, A>::Reader::read()
+	{
+		// The epoch is announced before loading the version, so a writer
+		// that doesn't see it has already published a newer version. The
+		// nested Snapshots keep the oldest epoch, which also protects the
+		// newer versions
+		if (mNumSnapshots++ == 0) {
+			mSlot->epoch.store(mParent->mEpoch.load());
+		}
+
+		return Snapshot(this, mParent->mPublished.load());
+	}
+
+
+	template <typename T, typename A>
+	void RCUReleaseVector<T, A>::Reader::leave()
+	{
+		if (--mNumSnapshots == 0) {
+			mSlot->epoch.store(kInactive, std::memory_order_release);
+		}
+	}
+
+
+	template <typename T, typename A>
+	RCUReleaseVector<T, A>::RCUReleaseVector() :
+		mPublished(new VectorType()), mEpoch(0), mReaderSlots(nullptr) {}
+
+
+	template <typename T, typename A>
+	RCUReleaseVector<T, A>::~RCUReleaseVector()
+	{
+		delete mPublished.load();
+
+		ReaderSlot* slot = mReaderSlots.load();
+		while (slot) {
+			ReaderSlot* next = slot->next;
+			delete slot;
+			slot = next;
+		}
+	}
+
+
+	template <typename T, typename A>
+	typename RCUReleaseVector<T, A>::Reader RCUReleaseVector<T, A>::createReader()
+	{
+		for (ReaderSlot* slot = mReaderSlots.load(); slot; slot = slot->next) {
+			bool used = false;
+			if (!slot->used.load() && slot->used.compare_exchange_strong(used, true)) {
+				return Reader(this, slot);
+			}
+		}
+
+		ReaderSlot* slot = new ReaderSlot();
+		slot->epoch.store(kInactive);
+		slot->used.store(true);
+		slot->next = mReaderSlots.load();
+		while (!mReaderSlots.compare_exchange_weak(slot->next, slot));
+
+		return Reader(this, slot);
+	}
+
+
+	template <typename T, typename A>
+	void RCUReleaseVector<T, A>::publish()
+	{
+		std::unique_ptr<VectorType> version;
+		if (mFreeVersions.empty()) {
+			version = std::make_unique<VectorType>(mWorkingCopy);
+		}
+		else {
+			// The memory of the reclaimed version is reused if it's large
+			// enough
+			version = std::move(mFreeVersions.back());
+			mFreeVersions.pop_back();
+			*version = mWorkingCopy;
+		}
+
+		VectorType* old = mPublished.exchange(version.release());
+		mRetiredVersions.push_back({ std::unique_ptr<VectorType>(old), mEpoch.fetch_add(1) });
+
+		reclaim();
+	}
+
+
+	template <typename T, typename A>
+	typename RCUReleaseVector<T, A>::size_type RCUReleaseVector<T, A>::reclaim()
+	{
+		std::uint64_t minEpoch = kInactive;
+		for (ReaderSlot* slot = mReaderSlots.load(); slot; slot = slot->next) {
+			minEpoch = std::min(minEpoch, slot->epoch.load());
+		}
+
+		// A version retired in an epoch can be used only by the readers that
+		// entered in that epoch or before
+		auto itReclaimed = std::stable_partition(
+			mRetiredVersions.begin(), mRetiredVersions.end(),
+			[&](const RetiredVersion& retired) { return retired.epoch >= minEpoch; }
+		);
+
+		size_type numReclaimed = std::distance(itReclaimed, mRetiredVersions.end());
+		for (auto it = itReclaimed; it != mRetiredVersions.end(); ++it) {
+			mFreeVersions.push_back(std::move(it->version));
+		}
+		mRetiredVersions.erase(itReclaimed, mRetiredVersions.end());
+
+		// Only one version is kept for reuse
+		if (mFreeVersions.size() > 1) {
+			mFreeVersions.resize(1);
+		}
+
+		return numReclaimed;
+	}
+
+}
+
+#endif		// STDEXT_RCU_RELEASE_VECTOR_HPP
@@ -0,0 +1,206 @@
+#ifndef STDEXT_RELEASE_SOA_H
+#define STDEXT_RELEASE_SOA_H
+
+#include <tuple>
+#include <vector>
+#include "ReleaseVector.h"
+
+namespace stdext {
+
+	/**
+	 * Class ReleaseSoA, it works as a ReleaseVector of structs with members
+	 * of types @tparam Ts, but each member (column) is stored in its own
+	 * contiguous array (structure of arrays). All the columns share the same
+	 * released indices and active flags, so an Element is created or removed
+	 * in every column at once, and the indices to the other elements aren't
+	 * invalidated. The columns can be iterated separately, so only the memory
+	 * of the needed ones is accessed.
+	 *
+	 * @note	it doesn't prevent from pointer invalidations due to the
+	 *			increment of the vector size with new allocations
+	 */
+	template <typename... Ts>
+	class ReleaseSoA
+	{
+	private:
+		static_assert(sizeof...(Ts) > 0, "there must be at least one column");
+	public:		// Nested types
+		using size_type = std::size_t;
+		template <std::size_t I>
+		using column_type = std::tuple_element_t<I, std::tuple<Ts...>>;
+
+	private:	// Attributes
+		/** Pointers to the Elements of each column of the ReleaseSoA */
+		std::tuple<Ts*...> mColumns;
+
+		/** The number of Elements reserved in each column */
+		size_type mCapacity;
+
+		/** The index of the past-the-end Element of the ReleaseSoA.
+		 * @note the previous element to the end could have been released */
+		size_type mEndIndex;
+
+		/** The indices to the released Elements of the ReleaseSoA */
+		std::vector<size_type> mReleasedIndices;
+
+		/** If each of the Elements up to @see mEndIndex is active or not */
+		std::vector<bool> mActiveFlags;
+
+		/** The policy used for choosing the released Element to reuse */
+		ReusePolicy mReusePolicy;
+
+	public:		// Functions
+		/** Creates a new ReleaseSoA */
+		ReleaseSoA() :
+			mColumns{}, mCapacity(0), mEndIndex(0),
+			mReusePolicy(ReusePolicy::LastReleased) {};
+		ReleaseSoA(const ReleaseSoA& other);
+		ReleaseSoA(ReleaseSoA&& other);
+
+		/** Class destructor */
+		~ReleaseSoA();
+
+		/** Assignment operator */
+		ReleaseSoA& operator=(const ReleaseSoA& other);
+		ReleaseSoA& operator=(ReleaseSoA&& other);
+
+		/** Returns the member of the column @tparam I of the Element i
+		 *
+		 * @param	i the index of the Element
+		 * @return	a reference to the member */
+		template <std::size_t I>
+		column_type<I>& get(size_type i)
+		{ return std::get<I>(mColumns)[i]; }
+
+		/** Returns the member of the column @tparam I of the Element i
+		 *
+		 * @param	i the index of the Element
+		 * @return	a const reference to the member */
+		template <std::size_t I>
+		const column_type<I>& get(size_type i) const
+		{ return std::get<I>(mColumns)[i]; }
+
+		/** @return	a pointer to the internal buffer of the column @tparam I */
+		template <std::size_t I>
+		column_type<I>* data() { return std::get<I>(mColumns); }
+
+		/** @return	a pointer to the internal buffer of the column @tparam I */
+		template <std::size_t I>
+		const column_type<I>* data() const { return std::get<I>(mColumns); }
+
+		/** @return	the number of Elements that can be added to the
+		 *			ReleaseSoA without reallocating it */
+		size_type capacity() const { return mCapacity; };
+
+		/** @return	the number of Elements in the ReleaseSoA */
+		size_type size() const
+		{ return mEndIndex - mReleasedIndices.size(); };
+
+		/** @return	true if the ReleaseSoA has no Elements inside, false
+		 *			otherwise */
+		bool empty() const { return (size() == 0); };
+
+		/** @return	the index of the past-the-end Element of the ReleaseSoA */
+		size_type endIndex() const { return mEndIndex; };
+
+		/** Changes the ReleaseSoA capacity so it can be added up to the
+		 * given elements without reallocating
+		 *
+		 * @param	n the new minimum capacity of the ReleaseSoA */
+		void reserve(size_type n);
+
+		/** Removes all the elements in the ReleaseSoA */
+		void clear();
+
+		/** @return	the policy used for choosing the released Elements to
+		 *			reuse */
+		ReusePolicy getReusePolicy() const { return mReusePolicy; };
+
+		/** Sets the policy used for choosing the released Elements to reuse
+		 *
+		 * @param	policy the new ReusePolicy */
+		void setReusePolicy(ReusePolicy policy);
+
+		/** Creates a new Element in the ReleaseSoA or reuses an already
+		 * released one
+		 *
+		 * @param	args the values used for constructing the member of each
+		 *			column, one per column. If there are no arguments, the
+		 *			members will be default constructed
+		 * @return	the index of the Element */
+		template <typename... Args>
+		size_type emplace(Args&&... args);
+
+		/** Removes the Element located at the given index from all the
+		 * columns of the ReleaseSoA
+		 *
+		 * @param	i the index of the Element
+		 * @note	the element will be released instead of deleted so the
+		 *			indices to the other elements won't need to be updated */
+		void erase(size_type i);
+
+		/** Checks if the Element given located at the given index is valid and
+		 * active
+		 *
+		 * @param	i the index of the Element
+		 * @return	true if is valid and active false otherwise */
+		bool isActive(size_type i) const
+		{ return (i < mEndIndex) && mActiveFlags[i]; };
+
+		/** Calls the given function for each active Element of the
+		 * ReleaseSoA with the members of the columns @tparam Is
+		 *
+		 * @param	f the function to call. It can receive the index of the
+		 *			Element followed by the members, or only the members */
+		template <std::size_t... Is, typename F>
+		void forEach(F&& f);
+
+		/** Calls the given function for each active Element of the
+		 * ReleaseSoA with the members of the columns @tparam Is
+		 *
+		 * @param	f the function to call. It can receive the index of the
+		 *			Element followed by the members, or only the members */
+		template <std::size_t... Is, typename F>
+		void forEach(F&& f) const;
+	private:
+		/** Changes the capacity of the ReleaseSoA to the given one, moving
+		 * the Elements of each column to new buffers
+		 *
+		 * @param	n the new capacity of the ReleaseSoA */
+		template <std::size_t... Is>
+		void reallocate(size_type n, std::index_sequence<Is...>);
+
+		/** Copies the active Elements of the given ReleaseSoA to the current
+		 * one, which must have the same indices but no Elements constructed
+		 *
+		 * @param	other the ReleaseSoA to copy */
+		template <std::size_t... Is>
+		void copyElements(const ReleaseSoA& other, std::index_sequence<Is...>);
+
+		/** Constructs the members of the Element i in each column
+		 *
+		 * @param	i the index of the Element
+		 * @param	args the values used for constructing each member */
+		template <std::size_t... Is, typename... Args>
+		void construct(size_type i, std::index_sequence<Is...>, Args&&... args);
+
+		/** Destroys the members of the Element i in each column
+		 *
+		 * @param	i the index of the Element */
+		template <std::size_t... Is>
+		void destroy(size_type i, std::index_sequence<Is...>);
+
+		/** Calls the given function for each active Element with the given
+		 * ReleaseSoA columns
+		 *
+		 * @param	self the ReleaseSoA to iterate
+		 * @param	f the function to call */
+		template <std::size_t... Is, typename Self, typename F>
+		static void forEachImpl(Self& self, F&& f);
+	};
+
+}
+
+#include "ReleaseSoA.hpp"
+
+#endif		// STDEXT_RELEASE_SOA_H
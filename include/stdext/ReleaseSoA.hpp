@@ -0,0 +1,264 @@
+#ifndef STDEXT_RELEASE_SOA_HPP
+#define STDEXT_RELEASE_SOA_HPP
+
+#include <memory>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+
+namespace stdext {
+
+	template <typename... Ts>
+	ReleaseSoA<Ts...>::ReleaseSoA(const ReleaseSoA& other) :
+		mColumns{}, mCapacity(0), mEndIndex(0),
+		mReusePolicy(other.mReusePolicy)
+	{
+		reserve(other.mCapacity);
+		mEndIndex = other.mEndIndex;
+		mReleasedIndices = other.mReleasedIndices;
+		mActiveFlags = other.mActiveFlags;
+		copyElements(other, std::index_sequence_for<Ts...>());
+	}
+
+
+	template <typename... Ts>
+	ReleaseSoA<Ts...>::ReleaseSoA(ReleaseSoA&& other) :
+		mColumns(other.mColumns), mCapacity(other.mCapacity),
+		mEndIndex(other.mEndIndex), mReleasedIndices(std::move(other.mReleasedIndices)),
+		mActiveFlags(std::move(other.mActiveFlags)), mReusePolicy(other.mReusePolicy)
+	{
+		other.mColumns = {};
+		other.mCapacity = 0;
+		other.mEndIndex = 0;
+		other.mReleasedIndices.clear();
+		other.mActiveFlags.clear();
+	}
+
+
+	template <typename... Ts>
+	ReleaseSoA<Ts...>::~ReleaseSoA()
+	{
+		clear();
+		reallocate(0, std::index_sequence_for<Ts...>());
+	}
+
+
+	template <typename... Ts>
+	ReleaseSoA<Ts...>& ReleaseSoA<Ts...>::operator=(const ReleaseSoA& other)
+	{
+		if (this != &other) {
+			clear();
+
+			reserve(other.mCapacity);
+			mEndIndex = other.mEndIndex;
+			mReleasedIndices = other.mReleasedIndices;
+			mActiveFlags = other.mActiveFlags;
+			mReusePolicy = other.mReusePolicy;
+			copyElements(other, std::index_sequence_for<Ts...>());
+		}
+
+		return *this;
+	}
+
+
+	template <typename... Ts>
+	ReleaseSoA<Ts...>& ReleaseSoA<Ts...>::operator=(ReleaseSoA&& other)
+	{
+		if (this != &other) {
+			clear();
+			reallocate(0, std::index_sequence_for<Ts...>());
+
+			mColumns = other.mColumns;
+			mCapacity = other.mCapacity;
+			mEndIndex = other.mEndIndex;
+			mReleasedIndices = std::move(other.mReleasedIndices);
+			mActiveFlags = std::move(other.mActiveFlags);
+			mReusePolicy = other.mReusePolicy;
+
+			other.mColumns = {};
+			other.mCapacity = 0;
+			other.mEndIndex = 0;
+			other.mReleasedIndices.clear();
+			other.mActiveFlags.clear();
+		}
+
+		return *this;
+	}
+
+
+	template <typename... Ts>
+	void ReleaseSoA<Ts...>::reserve(size_type n)
+	{
+		if (n > mCapacity) {
+			reallocate(n, std::index_sequence_for<Ts...>());
+		}
+	}
+
+
+	template <typename... Ts>
+	void ReleaseSoA<Ts...>::clear()
+	{
+		for (size_type i = 0; i < mEndIndex; ++i) {
+			if (mActiveFlags[i]) {
+				destroy(i, std::index_sequence_for<Ts...>());
+			}
+		}
+
+		mEndIndex = 0;
+		mReleasedIndices.clear();
+		mActiveFlags.clear();
+	}
+
+
+	template <typename... Ts>
+	void ReleaseSoA<Ts...>::setReusePolicy(ReusePolicy policy)
+	{
+		if ((policy == ReusePolicy::LowestIndex) && (mReusePolicy != ReusePolicy::LowestIndex)) {
+			std::make_heap(mReleasedIndices.begin(), mReleasedIndices.end(), std::greater<size_type>());
+		}
+		mReusePolicy = policy;
+	}
+
+
+	template <typename... Ts>
+	template <typename... Args>
+	typename ReleaseSoA<Ts...>::size_type ReleaseSoA<Ts...>::emplace(Args&&... args)
+	{
+		static_assert((sizeof...(Args) == 0) || (sizeof...(Args) == sizeof...(Ts)),
+			"there must be one argument per column or none");
+
+		size_type index;
+		if (mReleasedIndices.empty()) {
+			if (mCapacity == 0) {
+				reserve(1);
+			}
+			else if (mEndIndex + 1 > mCapacity) {
+				reserve(2 * mCapacity);
+			}
+			index = mEndIndex++;
+			mActiveFlags.push_back(false);
+		}
+		else {
+			if (mReusePolicy == ReusePolicy::LowestIndex) {
+				std::pop_heap(mReleasedIndices.begin(), mReleasedIndices.end(), std::greater<size_type>());
+			}
+			index = mReleasedIndices.back();
+			mReleasedIndices.pop_back();
+		}
+
+		construct(index, std::index_sequence_for<Ts...>(), std::forward<Args>(args)...);
+		mActiveFlags[index] = true;
+		return index;
+	}
+
+
+	template <typename... Ts>
+	void ReleaseSoA<Ts...>::erase(size_type i)
+	{
+		if (isActive(i)) {
+			destroy(i, std::index_sequence_for<Ts...>());
+			mActiveFlags[i] = false;
+			mReleasedIndices.push_back(i);
+			if (mReusePolicy == ReusePolicy::LowestIndex) {
+				std::push_heap(mReleasedIndices.begin(), mReleasedIndices.end(), std::greater<size_type>());
+			}
+		}
+	}
+
+
+	template <typename... Ts>
+	template <std::size_t... Is, typename F>
+	void ReleaseSoA<Ts...>::forEach(F&& f)
+	{
+		forEachImpl<Is...>(*this, std::forward<F>(f));
+	}
+
+
+	template <typename... Ts>
+	template <std::size_t... Is, typename F>
+	void ReleaseSoA<Ts...>::forEach(F&& f) const
+	{
+		forEachImpl<Is...>(*this, std::forward<F>(f));
+	}
+
+
+	template <typename... Ts>
+	template <std::size_t... Is>
+	void ReleaseSoA<Ts...>::reallocate(size_type n, std::index_sequence<Is...>)
+	{
+		auto reallocateColumn = [&](auto& column) {
+			using U = std::remove_reference_t<decltype(*column)>;
+			std::allocator<U> allocator;
+
+			U* buffer = (n > 0)? allocator.allocate(n) : nullptr;
+			for (size_type i = 0; i < mEndIndex; ++i) {
+				if (mActiveFlags[i]) {
+					new (&buffer[i]) U(std::move(column[i]));
+					column[i].~U();
+				}
+			}
+			if (mCapacity > 0) {
+				allocator.deallocate(column, mCapacity);
+			}
+
+			column = buffer;
+		};
+
+		(reallocateColumn(std::get<Is>(mColumns)), ...);
+		mCapacity = n;
+	}
+
+
+	template <typename... Ts>
+	template <std::size_t... Is>
+	void ReleaseSoA<Ts...>::copyElements(const ReleaseSoA& other, std::index_sequence<Is...>)
+	{
+		for (size_type i = 0; i < mEndIndex; ++i) {
+			if (mActiveFlags[i]) {
+				(new (&std::get<Is>(mColumns)[i]) Ts(std::get<Is>(other.mColumns)[i]), ...);
+			}
+		}
+	}
+
+
+	template <typename... Ts>
+	template <std::size_t... Is, typename... Args>
+	void ReleaseSoA<Ts...>::construct(size_type i, std::index_sequence<Is...>, Args&&... args)
+	{
+		if constexpr (sizeof...(Args) == 0) {
+			(new (&std::get<Is>(mColumns)[i]) Ts(), ...);
+		}
+		else {
+			(new (&std::get<Is>(mColumns)[i]) Ts(std::forward<Args>(args)), ...);
+		}
+	}
+
+
+	template <typename... Ts>
+	template <std::size_t... Is>
+	void ReleaseSoA<Ts...>::destroy(size_type i, std::index_sequence<Is...>)
+	{
+		(std::get<Is>(mColumns)[i].~Ts(), ...);
+	}
+
+
+	template <typename... Ts>
+	template <std::size_t... Is, typename Self, typename F>
+	void ReleaseSoA<Ts...>::forEachImpl(Self& self, F&& f)
+	{
+		for (size_type i = 0; i < self.mEndIndex; ++i) {
+			if (self.mActiveFlags[i]) {
+				if constexpr (std::is_invocable_v<F, size_type, decltype(self.template get<Is>(i))...>) {
+					f(i, self.template get<Is>(i)...);
+				}
+				else {
+					f(self.template get<Is>(i)...);
+				}
+			}
+		}
+	}
+
+}
+
+#endif		// STDEXT_RELEASE_SOA_HPP
@@ -2,9 +2,16 @@
 #define STDEXT_RELEASE_VECTOR_H
 
 #include <vector>
+#include <iosfwd>
+#include "MemoryStats.h"
+#include "ChangeTracker.h"
 
 namespace stdext {
 
+	/** The policies to use for choosing the released Elements to reuse */
+	enum class ReusePolicy { LastReleased, LowestIndex };
+
+
 	/**
 	 * Class ReleaseVector, it works as an usual vector of elements of type
 	 * @tparam T but it also stores the removed elements instead of erasing
@@ -25,6 +32,9 @@ namespace stdext {
 		template <typename U, typename B>
 		friend class ReleaseVector;
 
+		template <typename U, typename B>
+		friend bool readSnapshot(std::istream& in, ReleaseVector<U, B>& vector);
+
 		/** Class PVIterator, it's the class used to iterate through the
 		 * elements of a ReleaseVector */
 		template <bool isConst>
@@ -154,9 +164,19 @@ namespace stdext {
 		/** The allocator used for creating objects of type T */
 		A mAllocator;
 
+		/** The policy used for choosing the released Element to reuse. With
+		 * ReusePolicy::LowestIndex @see mReleasedIndices is kept as a
+		 * min-heap */
+		ReusePolicy mReusePolicy;
+
+		/** The object used for recording the changes of the Elements */
+		ChangeTracker mChangeTracker;
+
 	public:		// Functions
 		/** Creates a new ReleaseVector */
-		ReleaseVector() : mElements(nullptr), mCapacity(0), mEndIndex(0) {};
+		ReleaseVector() :
+			mElements(nullptr), mCapacity(0), mEndIndex(0),
+			mReusePolicy(ReusePolicy::LastReleased) {};
 		ReleaseVector(const ReleaseVector& other);
 		ReleaseVector(ReleaseVector&& other);
 		ReleaseVector(
@@ -174,7 +194,9 @@ namespace stdext {
 		/** Returns the Element i of the ReleaseVector
 		 *
 		 * @param	i the index of the Element
-		 * @return	a reference to the Element */
+		 * @return	a reference to the Element
+		 * @note	the access isn't recorded as a modification, use
+		 *			@ref markModified after changing the Element */
 		T& operator[](size_type i) { return mElements[i]; };
 
 		/** Returns the Element i of the ReleaseVector
@@ -236,10 +258,22 @@ namespace stdext {
 		 * @param	n the new minimum capacity of the ReleaseVector */
 		void reserve(std::size_t n);
 
-		/** Removes all the elements in the ReleaseVector */
+		/** Removes all the elements in the ReleaseVector
+		 * @note	the capacity of the ReleaseVector won't change */
 		void clear();
 
-		/** @return	a pointer to the internal buffer of the ReleaseVector */
+		/** @return	the memory used by the ReleaseVector. The holes are the
+		 *			released Elements, the memory of the ChangeTracker isn't
+		 *			included */
+		MemoryStats getMemoryStats() const;
+
+		/** Releases the memory of the ReleaseVector that isn't being used,
+		 * reducing its capacity and the one of the released indices to the
+		 * index of the last active Element */
+		void shrink_to_fit();
+
+		/** @return	a pointer to the internal buffer of the ReleaseVector
+		 * @note	the changes done through the buffer aren't tracked */
 		T* data() { return mElements; };
 
 		/** @return	a pointer to the internal buffer of the ReleaseVector */
@@ -253,12 +287,46 @@ namespace stdext {
 		size_type numReleasedIndices() const
 		{ return mReleasedIndices.size(); };
 
+		/** Records the Element i as modified if the changes are being
+		 * tracked
+		 *
+		 * @param	i the index of the Element that has been changed */
+		void markModified(size_type i)
+		{ mChangeTracker.notify(i, ChangeType::Modified); };
+
+		/** @return	the object used for recording the changes of the
+		 *			Elements of the ReleaseVector. The tracking is disabled
+		 *			by default, once enabled the creation, modification
+		 *			(with @ref markModified) and removal of the Elements will
+		 *			be recorded */
+		ChangeTracker& getChangeTracker() { return mChangeTracker; };
+
+		/** @return	the object used for recording the changes of the
+		 *			Elements of the ReleaseVector */
+		const ChangeTracker& getChangeTracker() const
+		{ return mChangeTracker; };
+
+		/** @return	the policy used for choosing the released Elements to
+		 *			reuse */
+		ReusePolicy getReusePolicy() const { return mReusePolicy; };
+
+		/** Sets the policy used for choosing the released Elements to reuse
+		 *
+		 * @param	policy the new ReusePolicy. With ReusePolicy::LastReleased
+		 *			the last released Element will be reused first, with
+		 *			ReusePolicy::LowestIndex the released Element with the
+		 *			lowest index will be reused first, so the active
+		 *			Elements will be kept at the front of the vector */
+		void setReusePolicy(ReusePolicy policy);
+
 		/** Creates a new Element in the vector or reuses an already released
 		 * one
 		 *
 		 * @param	args the arguments needed for calling the constructor of
 		 *			the new Element
-		 * @return	an iterator to the Element */
+		 * @return	an iterator to the Element
+		 * @note	the released Element to reuse is chosen with the current
+		 *			ReusePolicy */
 		template <typename... Args>
 		iterator emplace(Args&&... args);
 
@@ -268,9 +336,38 @@ namespace stdext {
 		 * @param	it an iterator to the Element
 		 * @return	an iterator to the next Element
 		 * @note	the element will be released instead of deleted so the
-		 *			indices to the other elements won't need to be updated */
+		 *			indices to the other elements won't need to be updated.
+		 *			If there are no active Elements after it, the end of the
+		 *			ReleaseVector is moved back to the last active one */
 		iterator erase(const_iterator it);
 
+		/** Creates the given number of Elements at once, reusing the
+		 * released Elements first and growing the ReleaseVector at most once
+		 *
+		 * @param	count the number of Elements to create
+		 * @param	out the output iterator where the indices of the new
+		 *			Elements will be written
+		 * @param	args the arguments needed for calling the constructor of
+		 *			each new Element
+		 * @return	the output iterator past the last written index
+		 * @note	the released Elements to reuse are chosen with the current
+		 *			ReusePolicy */
+		template <typename OutputIt, typename... Args>
+		OutputIt emplaceN(size_type count, OutputIt out, const Args&... args);
+
+		/** Removes the Elements located at the given indices from the
+		 * ReleaseVector at once
+		 *
+		 * @param	first the initial iterator of the indices to remove
+		 * @param	last the past the end iterator of the indices to remove
+		 * @return	the number of Elements removed. The indices that aren't
+		 *			active or that are repeated are ignored
+		 * @note	unlike calling @see erase for each index, the cost
+		 *			doesn't depend on the product of the removed and the
+		 *			released Elements */
+		template <typename InputIt>
+		size_type eraseBatch(InputIt first, InputIt last);
+
 		/** Checks if the Element given located at the given index is valid and
 		 * active
 		 *
@@ -289,6 +386,59 @@ namespace stdext {
 		 *			and the new ones will be default initialized */
 		template <typename U>
 		void replicate(const ReleaseVector<U>& other, const T& value = T());
+
+		/** Moves all the active Elements of the ReleaseVector to the lowest
+		 * indices, so there are no released Elements left between them, and
+		 * releases the memory of the remaining capacity
+		 *
+		 * @param	remap the function to call for each moved Element with
+		 *			its old index and its new one as parameters
+		 * @note	the indices to the moved Elements will be invalidated, so
+		 *			they must be updated with @see remap */
+		template <typename F>
+		void compact(F&& remap);
+
+		/** Moves up to the given number of active Elements of the
+		 * ReleaseVector to the lowest released indices. The Elements are
+		 * taken from the end of the ReleaseVector, so the compaction can be
+		 * spread across multiple calls
+		 *
+		 * @param	maxMoves the maximum number of Elements to move
+		 * @param	remap the function to call for each moved Element with
+		 *			its old index and its new one as parameters
+		 * @return	true if there are no released Elements left between the
+		 *			active ones, false otherwise
+		 * @note	unlike @see compact(F&&), the capacity of the
+		 *			ReleaseVector won't be changed */
+		template <typename F>
+		bool compact(size_type maxMoves, F&& remap);
+	private:
+		/** Removes the released Elements located at the end of the
+		 * ReleaseVector, so @see mEndIndex is the index next to the last
+		 * active Element */
+		void trimTrailing();
+
+		/** Changes the capacity of the ReleaseVector to the given one,
+		 * moving the Elements to a new buffer
+		 *
+		 * @param	n the new capacity of the ReleaseVector. It must be
+		 *			larger or equal than @see mEndIndex */
+		void reallocate(size_type n);
+
+		/** Copies the active Elements of the given buffer to the same
+		 * indices of the ReleaseVector, which must not be constructed yet
+		 *
+		 * @param	elements a pointer to the Elements to copy
+		 * @note	if @tparam T is trivially copyable the whole buffer up to
+		 *			@see mEndIndex is copied at once */
+		void copyElements(const T* elements);
+
+		/** Calls the given function with the index of each active Element,
+		 * without searching every index in the released ones
+		 *
+		 * @param	f the function to call */
+		template <typename F>
+		void forEachActiveIndex(F&& f) const;
 	};
 
 }
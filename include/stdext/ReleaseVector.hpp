@@ -1,26 +1,31 @@
 #ifndef STDEXT_RELEASE_VECTOR_HPP
 #define STDEXT_RELEASE_VECTOR_HPP
 
+#include <cstring>
+#include <iterator>
 #include <algorithm>
+#include <functional>
+#include <type_traits>
 
 namespace stdext {
 
 	template <typename T, typename A>
 	ReleaseVector<T, A>::ReleaseVector(const ReleaseVector& other) :
-		mElements(nullptr), mCapacity(0),
-		mEndIndex(other.mEndIndex), mReleasedIndices(other.mReleasedIndices)
+		mElements(nullptr), mCapacity(0), mEndIndex(0),
+		mReusePolicy(other.mReusePolicy), mChangeTracker(other.mChangeTracker)
 	{
 		reserve(other.mCapacity);
-		for (auto it = other.begin(); it != other.end(); ++it) {
-			new (&mElements[it.getIndex()]) T(*it);
-		}
+		mEndIndex = other.mEndIndex;
+		mReleasedIndices = other.mReleasedIndices;
+		copyElements(other.mElements);
 	}
 
 
 	template <typename T, typename A>
 	ReleaseVector<T, A>::ReleaseVector(ReleaseVector&& other) :
 		mElements(other.mElements), mCapacity(other.mCapacity),
-		mEndIndex(other.mEndIndex), mReleasedIndices(std::move(other.mReleasedIndices))
+		mEndIndex(other.mEndIndex), mReleasedIndices(std::move(other.mReleasedIndices)),
+		mReusePolicy(other.mReusePolicy), mChangeTracker(std::move(other.mChangeTracker))
 	{
 		other.mElements = nullptr;
 		other.mCapacity = 0;
@@ -32,12 +37,13 @@ namespace stdext {
 	ReleaseVector<T, A>::ReleaseVector(
 		const T* elements, std::size_t capacity, std::size_t size,
 		const std::size_t* releasedIndices, std::size_t numReleasedIndices
-	) : mElements(nullptr), mCapacity(0), mEndIndex(0)
+	) : mElements(nullptr), mCapacity(0), mEndIndex(0),
+		mReusePolicy(ReusePolicy::LastReleased)
 	{
 		reserve(capacity);
 		mEndIndex = size + numReleasedIndices;
-		std::copy(elements, elements + mEndIndex, mElements);
-		std::copy(releasedIndices, releasedIndices + numReleasedIndices, std::back_inserter(mReleasedIndices));
+		mReleasedIndices.assign(releasedIndices, releasedIndices + numReleasedIndices);
+		copyElements(elements);
 	}
 
 
@@ -45,20 +51,24 @@ namespace stdext {
 	ReleaseVector<T, A>::~ReleaseVector()
 	{
 		clear();
-		mAllocator.deallocate(mElements, mCapacity);
+		if (mCapacity > 0) {
+			mAllocator.deallocate(mElements, mCapacity);
+		}
 	}
 
 
 	template <typename T, typename A>
 	ReleaseVector<T, A>& ReleaseVector<T, A>::operator=(const ReleaseVector& other)
 	{
-		clear();
-
-		mEndIndex = other.mEndIndex;
-		mReleasedIndices = other.mReleasedIndices;
-		reserve(other.mCapacity);
-		for (auto it = other.begin(); it != other.end(); ++it) {
-			new (&mElements[it.getIndex()]) T(*it);
+		if (this != &other) {
+			clear();
+
+			reserve(other.mCapacity);
+			mEndIndex = other.mEndIndex;
+			mReleasedIndices = other.mReleasedIndices;
+			mReusePolicy = other.mReusePolicy;
+			mChangeTracker = other.mChangeTracker;
+			copyElements(other.mElements);
 		}
 
 		return *this;
@@ -68,16 +78,23 @@ namespace stdext {
 	template <typename T, typename A>
 	ReleaseVector<T, A>& ReleaseVector<T, A>::operator=(ReleaseVector&& other)
 	{
-		clear();
+		if (this != &other) {
+			clear();
+			if (mCapacity > 0) {
+				mAllocator.deallocate(mElements, mCapacity);
+			}
 
-		mElements = other.mElements;
-		mCapacity = other.mCapacity;
-		mEndIndex = other.mEndIndex;
-		mReleasedIndices = std::move(other.mReleasedIndices);
+			mElements = other.mElements;
+			mCapacity = other.mCapacity;
+			mEndIndex = other.mEndIndex;
+			mReleasedIndices = std::move(other.mReleasedIndices);
+			mReusePolicy = other.mReusePolicy;
+			mChangeTracker = std::move(other.mChangeTracker);
 
-		other.mElements = nullptr;
-		other.mCapacity = 0;
-		other.mEndIndex = 0;
+			other.mElements = nullptr;
+			other.mCapacity = 0;
+			other.mEndIndex = 0;
+		}
 
 		return *this;
 	}
@@ -104,18 +121,7 @@ namespace stdext {
 	void ReleaseVector<T, A>::reserve(std::size_t n)
 	{
 		if (n > mCapacity) {
-			T* buffer = mAllocator.allocate(n);
-			if (mCapacity > 0) {
-				for (auto it = begin(); it != end(); ++it) {
-					new (&buffer[it.getIndex()]) T(std::move(*it));
-					(*it).~T();
-				}
-				mAllocator.deallocate(mElements, mCapacity);
-			}
-
-			mElements = buffer;
-			mCapacity = n;
-			mReleasedIndices.reserve(n);
+			reallocate(n);
 		}
 	}
 
@@ -123,9 +129,49 @@ namespace stdext {
 	template <typename T, typename A>
 	void ReleaseVector<T, A>::clear()
 	{
-		for (auto it = begin(); it != end();) {
-			it = erase(it);
+		if (!std::is_trivially_destructible_v<T> || mChangeTracker.isEnabled()) {
+			forEachActiveIndex([this](size_type i) {
+				mElements[i].~T();
+				mChangeTracker.notify(i, ChangeType::Released);
+			});
 		}
+
+		mEndIndex = 0;
+		mReleasedIndices.clear();
+	}
+
+
+	template <typename T, typename A>
+	MemoryStats ReleaseVector<T, A>::getMemoryStats() const
+	{
+		MemoryStats stats;
+		stats.numAllocations = (mCapacity > 0) + (mReleasedIndices.capacity() > 0);
+		stats.reservedBytes = mCapacity * sizeof(T) + mReleasedIndices.capacity() * sizeof(size_type);
+		stats.liveBytes = size() * sizeof(T);
+		stats.numElements = size();
+		stats.numHoles = mReleasedIndices.size();
+		return stats;
+	}
+
+
+	template <typename T, typename A>
+	void ReleaseVector<T, A>::shrink_to_fit()
+	{
+		trimTrailing();
+		if (mEndIndex < mCapacity) {
+			reallocate(mEndIndex);
+		}
+		mReleasedIndices.shrink_to_fit();
+	}
+
+
+	template <typename T, typename A>
+	void ReleaseVector<T, A>::setReusePolicy(ReusePolicy policy)
+	{
+		if ((policy == ReusePolicy::LowestIndex) && (mReusePolicy != ReusePolicy::LowestIndex)) {
+			std::make_heap(mReleasedIndices.begin(), mReleasedIndices.end(), std::greater<size_type>());
+		}
+		mReusePolicy = policy;
 	}
 
 
@@ -144,11 +190,15 @@ namespace stdext {
 			index = mEndIndex++;
 		}
 		else {
+			if (mReusePolicy == ReusePolicy::LowestIndex) {
+				std::pop_heap(mReleasedIndices.begin(), mReleasedIndices.end(), std::greater<size_type>());
+			}
 			index = mReleasedIndices.back();
 			mReleasedIndices.pop_back();
 		}
 
 		new (&mElements[index]) T(std::forward<Args>(args)...);
+		mChangeTracker.notify(index, ChangeType::Created);
 		return iterator(this, index);
 	}
 
@@ -162,13 +212,100 @@ namespace stdext {
 		size_type index = it.getIndex();
 		if (isActive(index)) {
 			mElements[index].~T();
-			mReleasedIndices.push_back(index);
+			mChangeTracker.notify(index, ChangeType::Released);
+			if (index + 1 == mEndIndex) {
+				// The Element is trimmed instead of released
+				--mEndIndex;
+				trimTrailing();
+				ret = end();
+			}
+			else {
+				mReleasedIndices.push_back(index);
+				if (mReusePolicy == ReusePolicy::LowestIndex) {
+					std::push_heap(mReleasedIndices.begin(), mReleasedIndices.end(), std::greater<size_type>());
+				}
+			}
 		}
 
 		return ret;
 	}
 
 
+	template <typename T, typename A>
+	template <typename OutputIt, typename... Args>
+	OutputIt ReleaseVector<T, A>::emplaceN(size_type count, OutputIt out, const Args&... args)
+	{
+		size_type numReused = std::min(count, mReleasedIndices.size());
+		size_type numAppended = count - numReused;
+		if (mEndIndex + numAppended > mCapacity) {
+			reserve(std::max(mEndIndex + numAppended, 2 * mCapacity));
+		}
+
+		// The indices to reuse are moved to the back of the released ones,
+		// in the same order in which emplace would pop them
+		if (mReusePolicy == ReusePolicy::LowestIndex) {
+			for (size_type i = 0; i < numReused; ++i) {
+				std::pop_heap(mReleasedIndices.begin(), mReleasedIndices.end() - i, std::greater<size_type>());
+			}
+		}
+
+		for (size_type i = 0; i < numReused; ++i) {
+			size_type index = mReleasedIndices[mReleasedIndices.size() - 1 - i];
+			new (&mElements[index]) T(args...);
+			mChangeTracker.notify(index, ChangeType::Created);
+			*out++ = index;
+		}
+		mReleasedIndices.resize(mReleasedIndices.size() - numReused);
+
+		for (size_type i = 0; i < numAppended; ++i) {
+			size_type index = mEndIndex++;
+			new (&mElements[index]) T(args...);
+			mChangeTracker.notify(index, ChangeType::Created);
+			*out++ = index;
+		}
+
+		return out;
+	}
+
+
+	template <typename T, typename A>
+	template <typename InputIt>
+	typename ReleaseVector<T, A>::size_type ReleaseVector<T, A>::eraseBatch(InputIt first, InputIt last)
+	{
+		std::vector<size_type> indices;
+		for (; first != last; ++first) {
+			if (static_cast<size_type>(*first) < mEndIndex) {
+				indices.push_back(static_cast<size_type>(*first));
+			}
+		}
+		std::sort(indices.begin(), indices.end());
+		indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+
+		// The indices already released are filtered with a single pass
+		std::vector<size_type> released(mReleasedIndices);
+		std::sort(released.begin(), released.end());
+
+		size_type numReleased = mReleasedIndices.size();
+		std::set_difference(
+			indices.begin(), indices.end(), released.begin(), released.end(),
+			std::back_inserter(mReleasedIndices)
+		);
+
+		for (auto it = mReleasedIndices.begin() + numReleased; it != mReleasedIndices.end(); ++it) {
+			mElements[*it].~T();
+			mChangeTracker.notify(*it, ChangeType::Released);
+		}
+
+		size_type numErased = mReleasedIndices.size() - numReleased;
+		if (mReusePolicy == ReusePolicy::LowestIndex) {
+			std::make_heap(mReleasedIndices.begin(), mReleasedIndices.end(), std::greater<size_type>());
+		}
+		trimTrailing();
+
+		return numErased;
+	}
+
+
 	template <typename T, typename A>
 	bool ReleaseVector<T, A>::isActive(size_type i) const
 	{
@@ -186,8 +323,151 @@ namespace stdext {
 		reserve(other.mCapacity);
 		mEndIndex = other.mEndIndex;
 		mReleasedIndices = other.mReleasedIndices;
-		for (auto it = begin(); it != end(); ++it) {
-			new (&(*it)) T(value);
+		if (mReusePolicy == ReusePolicy::LowestIndex) {
+			std::make_heap(mReleasedIndices.begin(), mReleasedIndices.end(), std::greater<size_type>());
+		}
+		forEachActiveIndex([&](size_type i) {
+			new (&mElements[i]) T(value);
+			mChangeTracker.notify(i, ChangeType::Created);
+		});
+	}
+
+
+	template <typename T, typename A>
+	template <typename F>
+	void ReleaseVector<T, A>::compact(F&& remap)
+	{
+		compact(mEndIndex, std::forward<F>(remap));
+		shrink_to_fit();
+	}
+
+
+	template <typename T, typename A>
+	template <typename F>
+	bool ReleaseVector<T, A>::compact(size_type maxMoves, F&& remap)
+	{
+		// Sorting the released indices in ascending order leaves the lowest
+		// holes at the front and the trailing released Elements at the back.
+		// An ascending sequence is also a valid min-heap
+		std::sort(mReleasedIndices.begin(), mReleasedIndices.end());
+
+		// Unlike trimTrailing, it relies on the sorted indices and doesn't
+		// pop the holes already filled (the ones before iFirstHole)
+		auto trimFrom = [this](size_type iFirstHole) {
+			while ((mReleasedIndices.size() > iFirstHole)
+				&& (mReleasedIndices.back() + 1 == mEndIndex)
+			) {
+				mReleasedIndices.pop_back();
+				--mEndIndex;
+			}
+		};
+
+		size_type iHole = 0;
+		trimFrom(iHole);
+		for (size_type numMoves = 0;
+			(numMoves < maxMoves) && (iHole < mReleasedIndices.size());
+			++numMoves
+		) {
+			size_type oldIndex = mEndIndex - 1, newIndex = mReleasedIndices[iHole++];
+			new (&mElements[newIndex]) T(std::move(mElements[oldIndex]));
+			mElements[oldIndex].~T();
+			--mEndIndex;
+
+			mChangeTracker.notify(oldIndex, ChangeType::Released);
+			mChangeTracker.notify(newIndex, ChangeType::Created);
+			remap(oldIndex, newIndex);
+			trimFrom(iHole);
+		}
+
+		mReleasedIndices.erase(mReleasedIndices.begin(), mReleasedIndices.begin() + iHole);
+		return mReleasedIndices.empty();
+	}
+
+
+	template <typename T, typename A>
+	void ReleaseVector<T, A>::trimTrailing()
+	{
+		if ((mEndIndex == 0)
+			|| (std::find(mReleasedIndices.begin(), mReleasedIndices.end(), mEndIndex - 1) == mReleasedIndices.end())
+		) {
+			return;
+		}
+
+		std::vector<size_type> released(mReleasedIndices);
+		std::sort(released.begin(), released.end());
+		while (!released.empty() && (released.back() + 1 == mEndIndex)) {
+			released.pop_back();
+			--mEndIndex;
+		}
+
+		// The order of the remaining indices is preserved
+		mReleasedIndices.erase(
+			std::remove_if(
+				mReleasedIndices.begin(), mReleasedIndices.end(),
+				[this](size_type i) { return i >= mEndIndex; }
+			),
+			mReleasedIndices.end()
+		);
+		if (mReusePolicy == ReusePolicy::LowestIndex) {
+			std::make_heap(mReleasedIndices.begin(), mReleasedIndices.end(), std::greater<size_type>());
+		}
+	}
+
+
+	template <typename T, typename A>
+	void ReleaseVector<T, A>::reallocate(size_type n)
+	{
+		T* buffer = (n > 0)? mAllocator.allocate(n) : nullptr;
+		if (mCapacity > 0) {
+			if constexpr (std::is_trivially_copyable_v<T>) {
+				if (mEndIndex > 0) {
+					std::memcpy(buffer, mElements, mEndIndex * sizeof(T));
+				}
+			}
+			else {
+				forEachActiveIndex([&](size_type i) {
+					new (&buffer[i]) T(std::move(mElements[i]));
+					mElements[i].~T();
+				});
+			}
+			mAllocator.deallocate(mElements, mCapacity);
+		}
+
+		mElements = buffer;
+		mCapacity = n;
+	}
+
+
+	template <typename T, typename A>
+	void ReleaseVector<T, A>::copyElements(const T* elements)
+	{
+		if constexpr (std::is_trivially_copyable_v<T>) {
+			// The released Elements are also copied, so there are no gaps
+			if (mEndIndex > 0) {
+				std::memcpy(mElements, elements, mEndIndex * sizeof(T));
+			}
+		}
+		else {
+			forEachActiveIndex([&](size_type i) { new (&mElements[i]) T(elements[i]); });
+		}
+	}
+
+
+	template <typename T, typename A>
+	template <typename F>
+	void ReleaseVector<T, A>::forEachActiveIndex(F&& f) const
+	{
+		std::vector<size_type> released(mReleasedIndices);
+		std::sort(released.begin(), released.end());
+
+		size_type iReleased = 0;
+		for (size_type i = 0; i < mEndIndex; ++i) {
+			if ((iReleased < released.size()) && (released[iReleased] == i)) {
+				++iReleased;
+			}
+			else {
+				f(i);
+			}
 		}
 	}
 
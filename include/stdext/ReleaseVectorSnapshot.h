@@ -0,0 +1,222 @@
+#ifndef STDEXT_RELEASE_VECTOR_SNAPSHOT_H
+#define STDEXT_RELEASE_VECTOR_SNAPSHOT_H
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <type_traits>
+#include "MappedFile.h"
+#include "ReleaseVector.h"
+
+namespace stdext {
+
+	/**
+	 * Struct SnapshotHeader, it's the header located at the start of the
+	 * binary snapshots of the ReleaseVectors. It's followed by the Elements
+	 * of the vector up to its end index (with the released ones filled with
+	 * zeros) and then by the sorted released indices as 64 bit integers. The
+	 * offsets are aligned so the snapshot can be used directly from a file
+	 * mapped into memory.
+	 */
+	struct SnapshotHeader
+	{
+		/** The magic number that identifies the snapshot files */
+		char magic[4];
+
+		/** The version of the snapshot format */
+		std::uint32_t version;
+
+		/** A known value used for detecting snapshots written with a
+		 * different byte order */
+		std::uint32_t byteOrder;
+
+		/** The size in bytes of each Element */
+		std::uint32_t elementSize;
+
+		/** The alignment in bytes of each Element */
+		std::uint64_t elementAlignment;
+
+		/** The index of the past-the-end Element of the ReleaseVector */
+		std::uint64_t endIndex;
+
+		/** The number of released indices */
+		std::uint64_t numReleasedIndices;
+
+		/** The offset in bytes of the Elements from the start of the
+		 * snapshot */
+		std::uint64_t elementsOffset;
+
+		/** The offset in bytes of the released indices from the start of
+		 * the snapshot */
+		std::uint64_t releasedIndicesOffset;
+	};
+
+	/** The current version of the snapshot format */
+	constexpr std::uint32_t kSnapshotVersion = 1;
+
+
+	/** Creates the header of a snapshot of a ReleaseVector of type
+	 * @tparam T
+	 *
+	 * @param	endIndex the index of the past-the-end Element
+	 * @param	numReleasedIndices the number of released indices
+	 * @return	the new SnapshotHeader */
+	template <typename T>
+	SnapshotHeader makeSnapshotHeader(
+		std::uint64_t endIndex, std::uint64_t numReleasedIndices
+	);
+
+
+	/** Checks if the given header is valid for a snapshot of a ReleaseVector
+	 * of type @tparam T
+	 *
+	 * @param	header the SnapshotHeader to check
+	 * @param	snapshotSize the size in bytes of the whole snapshot
+	 * @return	true if the header is valid, false otherwise */
+	template <typename T>
+	bool validateSnapshotHeader(
+		const SnapshotHeader& header, std::uint64_t snapshotSize
+	);
+
+
+	/** Checks if the given released indices of a snapshot are valid
+	 *
+	 * @param	releasedIndices a pointer to the released indices
+	 * @param	numReleasedIndices the number of released indices
+	 * @param	endIndex the index of the past-the-end Element of the
+	 *			snapshot
+	 * @return	true if the indices are sorted in ascending order without
+	 *			duplicates and they are smaller than endIndex, false
+	 *			otherwise */
+	bool validateReleasedIndices(
+		const std::uint64_t* releasedIndices, std::uint64_t numReleasedIndices,
+		std::uint64_t endIndex
+	);
+
+
+	/** Writes a binary snapshot of the given ReleaseVector in a single pass
+	 *
+	 * @param	out the stream where the snapshot will be written. It must be
+	 *			opened in binary mode
+	 * @param	vector the ReleaseVector to write
+	 * @return	true if the snapshot was written, false otherwise */
+	template <typename T, typename A>
+	bool writeSnapshot(std::ostream& out, const ReleaseVector<T, A>& vector);
+
+
+	/** Reads a binary snapshot written with @see writeSnapshot
+	 *
+	 * @param	in the stream where the snapshot will be read from. It must
+	 *			be opened in binary mode
+	 * @param	vector the ReleaseVector where the snapshot will be loaded
+	 *			(return). The Elements are read directly into it, so it's
+	 *			left empty if the snapshot couldn't be read
+	 * @return	true if the snapshot was read, false otherwise
+	 * @note	the memory of the ReleaseVector grows with the data read
+	 *			from the stream, so a corrupted header can't make it
+	 *			allocate more memory than the snapshot size */
+	template <typename T, typename A>
+	bool readSnapshot(std::istream& in, ReleaseVector<T, A>& vector);
+
+
+	/**
+	 * Class ReleaseVectorView, it gives access to the Elements of a binary
+	 * snapshot of a ReleaseVector of type @tparam T mapped into memory, so
+	 * they can be used without loading them. The view can't add nor remove
+	 * Elements.
+	 */
+	template <typename T>
+	class ReleaseVectorView
+	{
+	private:
+		static_assert(std::is_trivially_copyable_v<T>,
+			"snapshots can only store trivially copyable types");
+	public:		// Nested types
+		using size_type		= std::size_t;
+		using value_type	= T;
+
+	private:	// Attributes
+		/** The file with the snapshot */
+		MappedFile mFile;
+
+		/** A pointer to the Elements of the snapshot */
+		T* mElements;
+
+		/** The index of the past-the-end Element of the snapshot */
+		size_type mEndIndex;
+
+		/** A pointer to the sorted released indices of the snapshot */
+		const std::uint64_t* mReleasedIndices;
+
+		/** The number of released indices */
+		size_type mNumReleasedIndices;
+
+	public:		// Functions
+		/** Creates a new ReleaseVectorView without any snapshot */
+		ReleaseVectorView() :
+			mElements(nullptr), mEndIndex(0),
+			mReleasedIndices(nullptr), mNumReleasedIndices(0) {};
+
+		/** Maps the given snapshot file into memory
+		 *
+		 * @param	path the path of the snapshot file
+		 * @param	mode the access mode of the Elements. With
+		 *			MappedFile::Mode::CopyOnWrite the Elements can be
+		 *			modified, copying only the memory pages that are written
+		 * @return	true if the snapshot was mapped, false if it couldn't be
+		 *			opened or it's not valid */
+		bool open(
+			const char* path,
+			MappedFile::Mode mode = MappedFile::Mode::ReadOnly
+		);
+
+		/** Unmaps the current snapshot */
+		void close();
+
+		/** Returns the Element i of the snapshot
+		 *
+		 * @param	i the index of the Element
+		 * @return	a const reference to the Element */
+		const T& operator[](size_type i) const { return mElements[i]; };
+
+		/** @return	a pointer to the Elements of the snapshot */
+		const T* data() const { return mElements; };
+
+		/** @return	a pointer to the Elements of the snapshot, nullptr if
+		 *			it wasn't mapped with MappedFile::Mode::CopyOnWrite */
+		T* mutableData();
+
+		/** @return	the index of the past-the-end Element of the snapshot */
+		size_type endIndex() const { return mEndIndex; };
+
+		/** @return	the number of Elements in the snapshot */
+		size_type size() const { return mEndIndex - mNumReleasedIndices; };
+
+		/** @return	true if the snapshot has no Elements, false otherwise */
+		bool empty() const { return (size() == 0); };
+
+		/** @return	a pointer to the released indices, sorted in ascending
+		 *			order */
+		const std::uint64_t* releasedIndices() const
+		{ return mReleasedIndices; };
+
+		/** @return	the number of indices that has been released */
+		size_type numReleasedIndices() const { return mNumReleasedIndices; };
+
+		/** Checks if the Element given located at the given index is valid and
+		 * active
+		 *
+		 * @param	i the index of the Element
+		 * @return	true if is valid and active false otherwise */
+		bool isActive(size_type i) const;
+
+		/** @return	a ReleaseVector with a copy of the snapshot Elements */
+		template <typename A = std::allocator<T>>
+		ReleaseVector<T, A> toReleaseVector() const;
+	};
+
+}
+
+#include "ReleaseVectorSnapshot.hpp"
+
+#endif		// STDEXT_RELEASE_VECTOR_SNAPSHOT_H
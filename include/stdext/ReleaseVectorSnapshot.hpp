@@ -0,0 +1,288 @@
+#ifndef STDEXT_RELEASE_VECTOR_SNAPSHOT_HPP
+#define STDEXT_RELEASE_VECTOR_SNAPSHOT_HPP
+
+#include <limits>
+#include <memory>
+#include <vector>
+#include <cstring>
+#include <algorithm>
+
+namespace stdext {
+
+	template <typename T>
+	SnapshotHeader makeSnapshotHeader(std::uint64_t endIndex, std::uint64_t numReleasedIndices)
+	{
+		auto alignUp = [](std::uint64_t offset, std::uint64_t alignment) {
+			return (offset + alignment - 1) / alignment * alignment;
+		};
+
+		SnapshotHeader header = {};
+		std::memcpy(header.magic, "SXRV", sizeof(header.magic));
+		header.version = kSnapshotVersion;
+		header.byteOrder = 0x01020304;
+		header.elementSize = static_cast<std::uint32_t>(sizeof(T));
+		header.elementAlignment = alignof(T);
+		header.endIndex = endIndex;
+		header.numReleasedIndices = numReleasedIndices;
+
+		// The Elements are aligned to a cache line at least
+		header.elementsOffset = alignUp(sizeof(SnapshotHeader), std::max<std::uint64_t>(alignof(T), 64));
+		header.releasedIndicesOffset = alignUp(
+			header.elementsOffset + endIndex * sizeof(T), alignof(std::uint64_t)
+		);
+
+		return header;
+	}
+
+
+	template <typename T>
+	bool validateSnapshotHeader(const SnapshotHeader& header, std::uint64_t snapshotSize)
+	{
+		if ((std::memcmp(header.magic, "SXRV", sizeof(header.magic)) != 0)
+			|| (header.version != kSnapshotVersion)
+			|| (header.byteOrder != 0x01020304)
+			|| (header.elementSize != sizeof(T))
+			|| (header.elementAlignment != alignof(T))
+			|| (header.endIndex > std::numeric_limits<std::size_t>::max() / sizeof(T))
+			|| (header.numReleasedIndices > header.endIndex)
+		) {
+			return false;
+		}
+
+		// Every section is bounded by subtracting from the snapshot size, so
+		// the offsets can't wrap around
+		SnapshotHeader expected = makeSnapshotHeader<T>(0, 0);
+		if ((header.elementsOffset != expected.elementsOffset)
+			|| (header.elementsOffset > snapshotSize)
+			|| (header.endIndex > (snapshotSize - header.elementsOffset) / sizeof(T))
+		) {
+			return false;
+		}
+
+		std::uint64_t elementsEnd = header.elementsOffset + header.endIndex * sizeof(T);
+		std::uint64_t padding = header.releasedIndicesOffset - elementsEnd;
+		return (header.releasedIndicesOffset >= elementsEnd)
+			&& (padding < alignof(std::uint64_t))
+			&& (header.releasedIndicesOffset % alignof(std::uint64_t) == 0)
+			&& (header.releasedIndicesOffset <= snapshotSize)
+			&& (header.numReleasedIndices <= (snapshotSize - header.releasedIndicesOffset) / sizeof(std::uint64_t));
+	}
+
+
+	template <typename T, typename A>
+	bool writeSnapshot(std::ostream& out, const ReleaseVector<T, A>& vector)
+	{
+		static_assert(std::is_trivially_copyable_v<T>,
+			"snapshots can only store trivially copyable types");
+
+		std::size_t endIndex = vector.end().getIndex();
+		std::vector<std::uint64_t> released(
+			vector.releasedIndices(),
+			vector.releasedIndices() + vector.numReleasedIndices()
+		);
+		std::sort(released.begin(), released.end());
+
+		SnapshotHeader header = makeSnapshotHeader<T>(endIndex, released.size());
+		std::uint64_t offset = 0;
+		auto writeZeros = [&](std::uint64_t numBytes) {
+			static const char zeros[64] = {};
+			for (; numBytes > sizeof(zeros); numBytes -= sizeof(zeros)) {
+				out.write(zeros, sizeof(zeros));
+			}
+			out.write(zeros, static_cast<std::streamsize>(numBytes));
+		};
+		auto writeBytes = [&](const void* bytes, std::uint64_t numBytes) {
+			out.write(static_cast<const char*>(bytes), static_cast<std::streamsize>(numBytes));
+			offset += numBytes;
+		};
+
+		writeBytes(&header, sizeof(SnapshotHeader));
+		writeZeros(header.elementsOffset - offset);
+		offset = header.elementsOffset;
+
+		// The active Elements are written in contiguous runs, and the
+		// released ones are replaced with zeros
+		std::size_t runStart = 0;
+		for (std::uint64_t releasedIndex : released) {
+			writeBytes(vector.data() + runStart, (releasedIndex - runStart) * sizeof(T));
+			writeZeros(sizeof(T));
+			offset += sizeof(T);
+			runStart = releasedIndex + 1;
+		}
+		writeBytes(vector.data() + runStart, (endIndex - runStart) * sizeof(T));
+
+		writeZeros(header.releasedIndicesOffset - offset);
+		offset = header.releasedIndicesOffset;
+		writeBytes(released.data(), released.size() * sizeof(std::uint64_t));
+
+		return out.good();
+	}
+
+
+	template <typename T, typename A>
+	bool readSnapshot(std::istream& in, ReleaseVector<T, A>& vector)
+	{
+		static_assert(std::is_trivially_copyable_v<T>,
+			"snapshots can only store trivially copyable types");
+		using size_type = typename ReleaseVector<T, A>::size_type;
+
+		SnapshotHeader header;
+		if (!in.read(reinterpret_cast<char*>(&header), sizeof(SnapshotHeader))) {
+			return false;
+		}
+
+		// If the stream is seekable, the header is checked against its
+		// remaining bytes
+		std::uint64_t snapshotSize = std::numeric_limits<std::uint64_t>::max();
+		std::istream::pos_type current = in.tellg();
+		if (current != std::istream::pos_type(-1)) {
+			in.seekg(0, std::ios::end);
+			std::istream::pos_type last = in.tellg();
+			in.seekg(current);
+			if (last != std::istream::pos_type(-1)) {
+				snapshotSize = sizeof(SnapshotHeader) + static_cast<std::uint64_t>(last - current);
+			}
+		}
+
+		if (!validateSnapshotHeader<T>(header, snapshotSize)
+			|| (header.endIndex > std::allocator_traits<A>::max_size(vector.mAllocator))
+		) {
+			return false;
+		}
+
+		vector.clear();
+		auto fail = [&]() {
+			vector.clear();
+			return false;
+		};
+
+		// The Elements are read in chunks that grow with the data read, so
+		// the buffer is only as large as the data actually found
+		std::size_t endIndex = static_cast<std::size_t>(header.endIndex);
+		in.ignore(static_cast<std::streamsize>(header.elementsOffset - sizeof(SnapshotHeader)));
+		while (in && (vector.mEndIndex < endIndex)) {
+			std::size_t chunkSize = std::min(
+				endIndex - vector.mEndIndex,
+				std::max<std::size_t>(vector.mEndIndex, 4096 / sizeof(T) + 1)
+			);
+			vector.reserve(vector.mEndIndex + chunkSize);
+			in.read(
+				reinterpret_cast<char*>(vector.mElements + vector.mEndIndex),
+				static_cast<std::streamsize>(chunkSize * sizeof(T))
+			);
+			vector.mEndIndex += chunkSize;
+		}
+		in.ignore(static_cast<std::streamsize>(
+			header.releasedIndicesOffset - header.elementsOffset - endIndex * sizeof(T)
+		));
+		if (!in) {
+			return fail();
+		}
+
+		// The released indices are bounded by the Elements already read
+		std::size_t numReleasedIndices = static_cast<std::size_t>(header.numReleasedIndices);
+		std::vector<std::uint64_t> released64;
+		const std::uint64_t* released = nullptr;
+		if constexpr (std::is_same_v<size_type, std::uint64_t>) {
+			vector.mReleasedIndices.resize(numReleasedIndices);
+			released = reinterpret_cast<const std::uint64_t*>(vector.mReleasedIndices.data());
+		}
+		else {
+			released64.resize(numReleasedIndices);
+			released = released64.data();
+		}
+		in.read(
+			reinterpret_cast<char*>(const_cast<std::uint64_t*>(released)),
+			static_cast<std::streamsize>(numReleasedIndices * sizeof(std::uint64_t))
+		);
+		if (!in || !validateReleasedIndices(released, numReleasedIndices, endIndex)) {
+			return fail();
+		}
+
+		if constexpr (!std::is_same_v<size_type, std::uint64_t>) {
+			vector.mReleasedIndices.assign(released64.begin(), released64.end());
+		}
+
+		// The sorted indices are also a valid min-heap for
+		// ReusePolicy::LowestIndex
+		if (vector.mChangeTracker.isEnabled()) {
+			vector.forEachActiveIndex([&](size_type i) {
+				vector.mChangeTracker.notify(i, ChangeType::Created);
+			});
+		}
+
+		return true;
+	}
+
+
+	template <typename T>
+	bool ReleaseVectorView<T>::open(const char* path, MappedFile::Mode mode)
+	{
+		close();
+
+		if (!mFile.open(path, mode)) {
+			return false;
+		}
+
+		SnapshotHeader header = {};
+		if (mFile.size() >= sizeof(SnapshotHeader)) {
+			std::memcpy(&header, mFile.data(), sizeof(SnapshotHeader));
+		}
+		if (!validateSnapshotHeader<T>(header, mFile.size())
+			|| !validateReleasedIndices(
+				reinterpret_cast<const std::uint64_t*>(mFile.data() + header.releasedIndicesOffset),
+				header.numReleasedIndices, header.endIndex
+			)
+		) {
+			mFile.close();
+			return false;
+		}
+
+		mElements = reinterpret_cast<T*>(mFile.data() + header.elementsOffset);
+		mEndIndex = static_cast<size_type>(header.endIndex);
+		mReleasedIndices = reinterpret_cast<const std::uint64_t*>(mFile.data() + header.releasedIndicesOffset);
+		mNumReleasedIndices = static_cast<size_type>(header.numReleasedIndices);
+		return true;
+	}
+
+
+	template <typename T>
+	void ReleaseVectorView<T>::close()
+	{
+		mFile.close();
+		mElements = nullptr;
+		mEndIndex = 0;
+		mReleasedIndices = nullptr;
+		mNumReleasedIndices = 0;
+	}
+
+
+	template <typename T>
+	T* ReleaseVectorView<T>::mutableData()
+	{
+		return (mFile.getMode() == MappedFile::Mode::CopyOnWrite)? mElements : nullptr;
+	}
+
+
+	template <typename T>
+	bool ReleaseVectorView<T>::isActive(size_type i) const
+	{
+		return (i < mEndIndex)
+			&& !std::binary_search(mReleasedIndices, mReleasedIndices + mNumReleasedIndices, std::uint64_t(i));
+	}
+
+
+	template <typename T>
+	template <typename A>
+	ReleaseVector<T, A> ReleaseVectorView<T>::toReleaseVector() const
+	{
+		std::vector<std::size_t> released(mReleasedIndices, mReleasedIndices + mNumReleasedIndices);
+		return ReleaseVector<T, A>(
+			mElements, mEndIndex, mEndIndex - released.size(),
+			released.data(), released.size()
+		);
+	}
+
+}
+
+#endif		// STDEXT_RELEASE_VECTOR_SNAPSHOT_HPP
@@ -0,0 +1,345 @@
+#ifndef STDEXT_SIMD_UTILS_H
+#define STDEXT_SIMD_UTILS_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <type_traits>
+#include "ArrayVector.h"
+#include "ReleaseVector.h"
+
+namespace stdext {
+
+	/** The SIMD instruction sets that can be used by the kernels */
+	enum class SIMDLevel { Scalar, SSE2, AVX2 };
+
+
+	/** The type returned by the sum of the elements of type @tparam T, the
+	 * integers are added in 64 bits so they don't overflow */
+	template <typename T>
+	using SumType = std::conditional_t<std::is_floating_point_v<T>, T,
+		std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>
+	>;
+
+
+	/** The type of the values compared with the elements of type @tparam T.
+	 * It isn't deduced from the arguments, so the values can be of other
+	 * types convertible to T, like int literals compared with shorts */
+	template <typename T>
+	using SIMDValue = typename std::common_type<T>::type;
+
+
+	/** @return	the best SIMD instruction set supported by the CPU. It's
+	 *			detected only the first time, the following calls return
+	 *			the same value */
+	SIMDLevel getSIMDLevel();
+
+
+	/** Searchs the given value in the given elements. The 32 and 64 bits
+	 * integers, float and double elements are compared with the best SIMD
+	 * instruction set supported by the CPU, the other types with a scalar
+	 * loop
+	 *
+	 * @param	data a pointer to the elements
+	 * @param	size the number of elements
+	 * @param	value the value to search
+	 * @return	the index of the first element equal to @param value,
+	 *			@param size if it wasn't found */
+	std::size_t simdFind(const std::int32_t* data, std::size_t size, std::int32_t value);
+	std::size_t simdFind(const float* data, std::size_t size, float value);
+	std::size_t simdFind(const double* data, std::size_t size, double value);
+	std::size_t simdFind(const std::int64_t* data, std::size_t size, std::int64_t value);
+	std::size_t simdFind(const std::uint32_t* data, std::size_t size, std::uint32_t value);
+	std::size_t simdFind(const std::uint64_t* data, std::size_t size, std::uint64_t value);
+	template <typename T>
+	std::size_t simdFind(const T* data, std::size_t size, const SIMDValue<T>& value)
+	{ return std::find(data, data + size, value) - data; }
+
+	/** Counts the number of elements equal to the given value
+	 *
+	 * @param	data a pointer to the elements
+	 * @param	size the number of elements
+	 * @param	value the value to count
+	 * @return	the number of elements equal to @param value */
+	std::size_t simdCount(const std::int32_t* data, std::size_t size, std::int32_t value);
+	std::size_t simdCount(const float* data, std::size_t size, float value);
+	std::size_t simdCount(const double* data, std::size_t size, double value);
+	std::size_t simdCount(const std::int64_t* data, std::size_t size, std::int64_t value);
+	std::size_t simdCount(const std::uint32_t* data, std::size_t size, std::uint32_t value);
+	std::size_t simdCount(const std::uint64_t* data, std::size_t size, std::uint64_t value);
+	template <typename T>
+	std::size_t simdCount(const T* data, std::size_t size, const SIMDValue<T>& value)
+	{ return std::count(data, data + size, value); }
+
+	/** Checks if the given value is in the given elements
+	 *
+	 * @param	data a pointer to the elements
+	 * @param	size the number of elements
+	 * @param	value the value to search
+	 * @return	true if the value was found, false otherwise */
+	template <typename T, typename U>
+	bool simdContains(const T* data, std::size_t size, const U& value)
+	{ return simdFind(data, size, static_cast<T>(value)) != size; }
+
+	/** Returns the minimum of the given elements
+	 *
+	 * @param	data a pointer to the elements
+	 * @param	size the number of elements
+	 * @return	the minimum element
+	 * @note	if there are no elements, it causes undefined behavior. If
+	 *			there are NaNs, the result is unspecified */
+	std::int32_t simdMin(const std::int32_t* data, std::size_t size);
+	float simdMin(const float* data, std::size_t size);
+	double simdMin(const double* data, std::size_t size);
+	template <typename T>
+	T simdMin(const T* data, std::size_t size)
+	{ return *std::min_element(data, data + size); }
+
+	/** Returns the maximum of the given elements
+	 *
+	 * @param	data a pointer to the elements
+	 * @param	size the number of elements
+	 * @return	the maximum element
+	 * @note	if there are no elements, it causes undefined behavior. If
+	 *			there are NaNs, the result is unspecified */
+	std::int32_t simdMax(const std::int32_t* data, std::size_t size);
+	float simdMax(const float* data, std::size_t size);
+	double simdMax(const double* data, std::size_t size);
+	template <typename T>
+	T simdMax(const T* data, std::size_t size)
+	{ return *std::max_element(data, data + size); }
+
+	/** Adds the given elements
+	 *
+	 * @param	data a pointer to the elements
+	 * @param	size the number of elements
+	 * @return	the sum of the elements
+	 * @note	the floating point elements are added in a different order
+	 *			than a sequential loop, so the result could differ in the
+	 *			last bits */
+	std::int64_t simdSum(const std::int32_t* data, std::size_t size);
+	float simdSum(const float* data, std::size_t size);
+	double simdSum(const double* data, std::size_t size);
+	template <typename T>
+	SumType<T> simdSum(const T* data, std::size_t size)
+	{
+		SumType<T> sum = 0;
+		for (std::size_t i = 0; i < size; ++i) {
+			sum += data[i];
+		}
+		return sum;
+	}
+
+
+	/** Searchs the given value in the given ArrayVector
+	 * @see simdFind
+	 * @return	an iterator to the first element equal to @param value, end
+	 *			if it wasn't found */
+	template <typename T, std::size_t N, std::size_t A, bool C>
+	const T* simdFind(const ArrayVector<T, N, A, C>& vector, const SIMDValue<T>& value)
+	{ return vector.data() + simdFind(vector.data(), vector.size(), value); }
+
+	/** @see simdCount */
+	template <typename T, std::size_t N, std::size_t A, bool C>
+	std::size_t simdCount(const ArrayVector<T, N, A, C>& vector, const SIMDValue<T>& value)
+	{ return simdCount(vector.data(), vector.size(), value); }
+
+	/** @see simdContains */
+	template <typename T, std::size_t N, std::size_t A, bool C>
+	bool simdContains(const ArrayVector<T, N, A, C>& vector, const SIMDValue<T>& value)
+	{ return simdContains(vector.data(), vector.size(), value); }
+
+	/** @see simdMin */
+	template <typename T, std::size_t N, std::size_t A, bool C>
+	T simdMin(const ArrayVector<T, N, A, C>& vector)
+	{ return simdMin(vector.data(), vector.size()); }
+
+	/** @see simdMax */
+	template <typename T, std::size_t N, std::size_t A, bool C>
+	T simdMax(const ArrayVector<T, N, A, C>& vector)
+	{ return simdMax(vector.data(), vector.size()); }
+
+	/** @see simdSum */
+	template <typename T, std::size_t N, std::size_t A, bool C>
+	SumType<T> simdSum(const ArrayVector<T, N, A, C>& vector)
+	{ return simdSum(vector.data(), vector.size()); }
+
+
+	/** The buffer used for sorting the released indices of a ReleaseVector
+	 * while iterating its active Elements. It can be reused between calls
+	 * so they don't allocate memory once it has grown */
+	using ActiveRunBuffer = std::vector<std::size_t>;
+
+
+	/** Calls the given function for each run of consecutive active Elements
+	 * of the given ReleaseVector, so they can be processed as contiguous
+	 * arrays
+	 *
+	 * @param	vector the ReleaseVector to iterate
+	 * @param	buffer the buffer where the released indices are sorted
+	 * @param	f the function to call. It receives the index of the first
+	 *			Element of the run and the number of Elements, and returns
+	 *			false if the iteration must stop */
+	template <typename T, typename A, typename F>
+	void forEachActiveRun(const ReleaseVector<T, A>& vector, ActiveRunBuffer& buffer, F&& f)
+	{
+		std::size_t endIndex = vector.end().getIndex();
+		if (vector.numReleasedIndices() == 0) {
+			if (endIndex > 0) {
+				f(std::size_t(0), endIndex);
+			}
+			return;
+		}
+
+		buffer.assign(
+			vector.releasedIndices(),
+			vector.releasedIndices() + vector.numReleasedIndices()
+		);
+		std::sort(buffer.begin(), buffer.end());
+		buffer.push_back(endIndex);
+
+		std::size_t first = 0;
+		for (std::size_t next : buffer) {
+			if ((next > first) && !f(first, next - first)) {
+				return;
+			}
+			first = next + 1;
+		}
+	}
+
+	/** @see forEachActiveRun
+	 * @note	if there are released Elements, their indices are sorted in
+	 *			a temporary buffer */
+	template <typename T, typename A, typename F>
+	void forEachActiveRun(const ReleaseVector<T, A>& vector, F&& f)
+	{
+		ActiveRunBuffer buffer;
+		forEachActiveRun(vector, buffer, std::forward<F>(f));
+	}
+
+	/** Searchs the given value in the active Elements of the given
+	 * ReleaseVector
+	 * @see simdFind
+	 * @param	buffer the buffer used for iterating the active Elements
+	 *			@see forEachActiveRun
+	 * @return	an iterator to the first active Element equal to
+	 *			@param value, end if it wasn't found */
+	template <typename T, typename A>
+	typename ReleaseVector<T, A>::const_iterator simdFind(
+		const ReleaseVector<T, A>& vector, const SIMDValue<T>& value,
+		ActiveRunBuffer& buffer
+	) {
+		std::size_t index = vector.end().getIndex();
+		forEachActiveRun(vector, buffer, [&](std::size_t first, std::size_t count) {
+			std::size_t i = simdFind(vector.data() + first, count, value);
+			if (i < count) {
+				index = first + i;
+				return false;
+			}
+			return true;
+		});
+
+		return typename ReleaseVector<T, A>::const_iterator(&vector, index);
+	}
+
+	/** @see simdCount */
+	template <typename T, typename A>
+	std::size_t simdCount(
+		const ReleaseVector<T, A>& vector, const SIMDValue<T>& value,
+		ActiveRunBuffer& buffer
+	) {
+		std::size_t ret = 0;
+		forEachActiveRun(vector, buffer, [&](std::size_t first, std::size_t count) {
+			ret += simdCount(vector.data() + first, count, value);
+			return true;
+		});
+		return ret;
+	}
+
+	/** @see simdContains */
+	template <typename T, typename A>
+	bool simdContains(
+		const ReleaseVector<T, A>& vector, const SIMDValue<T>& value,
+		ActiveRunBuffer& buffer
+	) { return simdFind(vector, value, buffer) != vector.end(); }
+
+	/** @see simdMin */
+	template <typename T, typename A>
+	T simdMin(const ReleaseVector<T, A>& vector, ActiveRunBuffer& buffer)
+	{
+		bool first = true;
+		T ret = T();
+		forEachActiveRun(vector, buffer, [&](std::size_t iFirst, std::size_t count) {
+			T runMin = simdMin(vector.data() + iFirst, count);
+			ret = (first || (runMin < ret))? runMin : ret;
+			first = false;
+			return true;
+		});
+		return ret;
+	}
+
+	/** @see simdMax */
+	template <typename T, typename A>
+	T simdMax(const ReleaseVector<T, A>& vector, ActiveRunBuffer& buffer)
+	{
+		bool first = true;
+		T ret = T();
+		forEachActiveRun(vector, buffer, [&](std::size_t iFirst, std::size_t count) {
+			T runMax = simdMax(vector.data() + iFirst, count);
+			ret = (first || (ret < runMax))? runMax : ret;
+			first = false;
+			return true;
+		});
+		return ret;
+	}
+
+	/** @see simdSum */
+	template <typename T, typename A>
+	SumType<T> simdSum(const ReleaseVector<T, A>& vector, ActiveRunBuffer& buffer)
+	{
+		SumType<T> ret = 0;
+		forEachActiveRun(vector, buffer, [&](std::size_t first, std::size_t count) {
+			ret += simdSum(vector.data() + first, count);
+			return true;
+		});
+		return ret;
+	}
+
+	/* The following functions use a temporary ActiveRunBuffer, so they
+	 * allocate memory if there are released Elements */
+
+	/** @see simdFind */
+	template <typename T, typename A>
+	typename ReleaseVector<T, A>::const_iterator simdFind(
+		const ReleaseVector<T, A>& vector, const SIMDValue<T>& value
+	) { ActiveRunBuffer buffer; return simdFind(vector, value, buffer); }
+
+	/** @see simdCount */
+	template <typename T, typename A>
+	std::size_t simdCount(const ReleaseVector<T, A>& vector, const SIMDValue<T>& value)
+	{ ActiveRunBuffer buffer; return simdCount(vector, value, buffer); }
+
+	/** @see simdContains */
+	template <typename T, typename A>
+	bool simdContains(const ReleaseVector<T, A>& vector, const SIMDValue<T>& value)
+	{ ActiveRunBuffer buffer; return simdContains(vector, value, buffer); }
+
+	/** @see simdMin */
+	template <typename T, typename A>
+	T simdMin(const ReleaseVector<T, A>& vector)
+	{ ActiveRunBuffer buffer; return simdMin(vector, buffer); }
+
+	/** @see simdMax */
+	template <typename T, typename A>
+	T simdMax(const ReleaseVector<T, A>& vector)
+	{ ActiveRunBuffer buffer; return simdMax(vector, buffer); }
+
+	/** @see simdSum */
+	template <typename T, typename A>
+	SumType<T> simdSum(const ReleaseVector<T, A>& vector)
+	{ ActiveRunBuffer buffer; return simdSum(vector, buffer); }
+
+}
+
+#endif		// STDEXT_SIMD_UTILS_H
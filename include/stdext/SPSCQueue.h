@@ -0,0 +1,148 @@
+#ifndef STDEXT_SPSC_QUEUE_H
+#define STDEXT_SPSC_QUEUE_H
+
+#include <atomic>
+#include <algorithm>
+#include <cstddef>
+
+namespace stdext {
+
+	/**
+	 * Class SPSCQueue, it's a wait-free queue of elements of type @tparam T
+	 * with a compile-time capacity of @tparam N elements, to be used by a
+	 * single producer thread and a single consumer thread. Like the ArrayDeque
+	 * the elements are stored inside the SPSCQueue in a circular buffer, so
+	 * it won't do any allocation at runtime.
+	 *
+	 * @note	the head and the tail of the queue are stored in different
+	 *			cache lines, so the producer and the consumer don't invalidate
+	 *			each other's caches unless the queue becomes empty or full
+	 */
+	template <typename T, std::size_t N>
+	class SPSCQueue
+	{
+	public:		// Nested types
+		using size_type		= std::size_t;
+		using value_type	= T;
+		using pointer		= T*;
+		using reference		= T&;
+
+	private:
+		/** The size in bytes of a cache line */
+		static constexpr size_type kCacheLineSize = 64;
+
+	private:	// Attributes
+		/** The number of Elements popped from the SPSCQueue. It's only
+		 * modified by the consumer */
+		alignas(kCacheLineSize) std::atomic<size_type> mHead;
+
+		/** The last value of @see mTail read by the consumer */
+		size_type mCachedTail;
+
+		/** The number of Elements pushed to the SPSCQueue. It's only modified
+		 * by the producer */
+		alignas(kCacheLineSize) std::atomic<size_type> mTail;
+
+		/** The last value of @see mHead read by the producer */
+		size_type mCachedHead;
+
+		/** The array of memory where the elements will be stored */
+		alignas(kCacheLineSize) alignas(T) std::byte mData[N * sizeof(T)];
+
+	public:		// Functions
+		/** Creates a new SPSCQueue */
+		SPSCQueue() : mHead(0), mCachedTail(0), mTail(0), mCachedHead(0) {};
+		SPSCQueue(const SPSCQueue& other) = delete;
+		SPSCQueue(SPSCQueue&& other) = delete;
+
+		/** Class destructor */
+		~SPSCQueue();
+
+		/** Assignment operator */
+		SPSCQueue& operator=(const SPSCQueue& other) = delete;
+		SPSCQueue& operator=(SPSCQueue&& other) = delete;
+
+		/** @return	the maximum number of elements that the SPSCQueue can
+		 *			store */
+		size_type capacity() const { return N; };
+
+		/** @return	the number of elements in the SPSCQueue
+		 * @note	it can be called from any thread, but if the SPSCQueue
+		 *			is being modified, the value could be outdated */
+		size_type size() const
+		{
+			// The head is loaded first, since the tail never falls behind
+			// it. Meanwhile the consumer could pop Elements and the
+			// producer push new ones, so the result is clamped to N
+			size_type head = mHead.load(std::memory_order_acquire);
+			size_type tail = mTail.load(std::memory_order_acquire);
+			return std::min(tail - head, N);
+		};
+
+		/** @return	true if the SPSCQueue has no elements, false otherwise
+		 * @note	it can be called from any thread, but if the SPSCQueue
+		 *			is being modified, the value could be outdated */
+		bool empty() const { return (size() == 0); };
+
+		/** Appends the given element to the end of the SPSCQueue. It must
+		 * be called only from the producer thread
+		 *
+		 * @param	element the element to append
+		 * @return	true if the element was appended, false if the SPSCQueue
+		 *			was full */
+		bool tryPush(const T& element) { return tryEmplace(element); };
+
+		/** Appends the given element to the end of the SPSCQueue. It must
+		 * be called only from the producer thread
+		 *
+		 * @param	element the element to append
+		 * @return	true if the element was appended, false if the SPSCQueue
+		 *			was full */
+		bool tryPush(T&& element) { return tryEmplace(std::move(element)); };
+
+		/** Appends a new element to the end of the SPSCQueue. It must be
+		 * called only from the producer thread
+		 *
+		 * @param	args the arguments needed for calling the constructor of
+		 *			the new Element
+		 * @return	true if the element was appended, false if the SPSCQueue
+		 *			was full */
+		template <typename... Args>
+		bool tryEmplace(Args&&... args);
+
+		/** Removes the first element of the SPSCQueue. It must be called
+		 * only from the consumer thread
+		 *
+		 * @param	element where the removed element will be moved
+		 * @return	true if an element was removed, false if the SPSCQueue
+		 *			was empty */
+		bool tryPop(T& element);
+
+		/** Returns the first element of the SPSCQueue without removing it.
+		 * It must be called only from the consumer thread
+		 *
+		 * @return	a pointer to the first element, nullptr if the SPSCQueue
+		 *			is empty */
+		T* front();
+
+		/** Removes the first element of the SPSCQueue. It must be called
+		 * only from the consumer thread
+		 *
+		 * @note	if the SPSCQueue is empty (@see front), it causes
+		 *			undefined behavior */
+		void pop();
+	private:
+		/** Returns the given Element of @see mData
+		 *
+		 * @param	counter the value of @see mHead or @see mTail of the
+		 *			Element
+		 * @return	a pointer to the Element */
+		T* getElement(size_type counter)
+		{ return reinterpret_cast<T*>(mData) + (counter % N); };
+	};
+
+}
+
+#include "SPSCQueue.hpp"
+
+#endif		// STDEXT_SPSC_QUEUE_H
@@ -0,0 +1,78 @@
+#ifndef STDEXT_SPSC_QUEUE_HPP
+#define STDEXT_SPSC_QUEUE_HPP
+
+#include <utility>
+
+namespace stdext {
+
+	template <typename T, std::size_t N>
+	SPSCQueue<T, N>::~SPSCQueue()
+	{
+		while (front()) {
+			pop();
+		}
+	}
+
+
+	template <typename T, std::size_t N>
+	template <typename... Args>
+	bool SPSCQueue<T, N>::tryEmplace(Args&&... args)
+	{
+		size_type tail = mTail.load(std::memory_order_relaxed);
+		if (tail - mCachedHead == N) {
+			// The cached head is only refreshed when the queue looks full,
+			// so the consumer's cache line is rarely read
+			mCachedHead = mHead.load(std::memory_order_acquire);
+			if (tail - mCachedHead == N) {
+				return false;
+			}
+		}
+
+		new (getElement(tail)) T(std::forward<Args>(args)...);
+		mTail.store(tail + 1, std::memory_order_release);
+
+		return true;
+	}
+
+
+	template <typename T, std::size_t N>
+	bool SPSCQueue<T, N>::tryPop(T& element)
+	{
+		T* first = front();
+		if (!first) {
+			return false;
+		}
+
+		element = std::move(*first);
+		pop();
+
+		return true;
+	}
+
+
+	template <typename T, std::size_t N>
+	T* SPSCQueue<T, N>::front()
+	{
+		size_type head = mHead.load(std::memory_order_relaxed);
+		if (head == mCachedTail) {
+			mCachedTail = mTail.load(std::memory_order_acquire);
+			if (head == mCachedTail) {
+				return nullptr;
+			}
+		}
+
+		return getElement(head);
+	}
+
+
+	template <typename T, std::size_t N>
+	void SPSCQueue<T, N>::pop()
+	{
+		size_type head = mHead.load(std::memory_order_relaxed);
+		getElement(head)->~T();
+		mHead.store(head + 1, std::memory_order_release);
+	}
+
+}
+
+#endif		// STDEXT_SPSC_QUEUE_HPP
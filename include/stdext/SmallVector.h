@@ -0,0 +1,378 @@
+#ifndef STDEXT_SMALL_VECTOR_H
+#define STDEXT_SMALL_VECTOR_H
+
+#include <memory>
+#include <cstddef>
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <initializer_list>
+#include "MemoryStats.h"
+
+namespace stdext {
+
+	/**
+	 * Class SmallVector, it's a container of elements of type @tparam T that
+	 * stores up to @tparam N elements inside itself like an ArrayVector, and
+	 * moves them to the heap when more elements are added. It has the same
+	 * API than ArrayVector, so it can be used in its place when the maximum
+	 * number of elements isn't known at compile time. The elements are
+	 * always stored contiguously. All the heap allocations will be done
+	 * using the allocator @tparam A.
+	 *
+	 * @note	the pointers and iterators to the elements are invalidated
+	 *			when the elements are moved to a larger buffer
+	 */
+	template <typename T, std::size_t N, typename A = std::allocator<T>>
+	class SmallVector
+	{
+	public:		// Nested types
+		using size_type					= std::size_t;
+		using difference_type			= std::ptrdiff_t;
+		using value_type				= T;
+		using pointer					= T*;
+		using reference					= T&;
+		using iterator					= T*;
+		using const_iterator			= const T*;
+		using reverse_iterator			= std::reverse_iterator<iterator>;
+		using const_reverse_iterator	= std::reverse_iterator<const_iterator>;
+
+	private:	// Attributes
+		/** The array of memory where the elements will be stored while they
+		 * fit inside it */
+		alignas(T) std::byte mInlineData[(N > 0)? N * sizeof(T) : sizeof(T)];
+
+		/** A pointer to the elements, located in @see mInlineData or in the
+		 * heap */
+		T* mElements;
+
+		/** The number of Elements added to the SmallVector */
+		size_type mNumElements;
+
+		/** The number of Elements that can be stored in @see mElements */
+		size_type mCapacity;
+
+		/** The allocator used for allocating the Elements in the heap */
+		A mAllocator;
+
+	public:		// Functions
+		/** Creates a new SmallVector */
+		SmallVector() :
+			mElements(reinterpret_cast<T*>(mInlineData)),
+			mNumElements(0), mCapacity(N) {};
+		SmallVector(const SmallVector& other);
+		SmallVector(SmallVector&& other);
+
+		/** Creates a new SmallVector
+		 *
+		 * @param	numElements the initial number of elements stored inside
+		 *			the SmallVector
+		 * @param	value the initial value with which the new values will be
+		 *			intialized */
+		SmallVector(size_type numElements, const T& value = T()) :
+			SmallVector() { resize(numElements, value); };
+
+		/** Creates a new SmallVector
+		 *
+		 * @param	list the initial elements stored inside the SmallVector */
+		SmallVector(std::initializer_list<T> list) :
+			SmallVector(list.begin(), list.end()) {};
+
+		/** Creates a new SmallVector
+		 *
+		 * @param	first the first iterator of the range to copy
+		 * @param	last the past-the-end iterator of the range to copy */
+		template <typename InputIterator, typename = typename
+			std::iterator_traits<InputIterator>::iterator_category
+		>
+		SmallVector(InputIterator first, InputIterator last);
+
+		/** Class destructor */
+		~SmallVector();
+
+		/** Assignment operator */
+		SmallVector& operator=(const SmallVector& other);
+		SmallVector& operator=(SmallVector&& other);
+
+		/** Returns the Element i of the SmallVector
+		 *
+		 * @param	i the index of the Element
+		 * @return	a reference to the Element */
+		T& operator[](size_type i) { return mElements[i]; };
+
+		/** Returns the Element i of the SmallVector
+		 *
+		 * @param	i the index of the Element
+		 * @return	a const reference to the Element */
+		const T& operator[](size_type i) const { return mElements[i]; };
+
+		/** Compares the given SmallVectors
+		 *
+		 * @param	lhs the first SmallVector to compare
+		 * @param	rhs the second SmallVector to compare
+		 * @return	true if both SmallVector are equal, false otherwise */
+		friend bool operator==(const SmallVector& lhs, const SmallVector& rhs)
+		{
+			return (lhs.mNumElements == rhs.mNumElements)
+				&& std::equal(lhs.begin(), lhs.end(), rhs.begin());
+		};
+
+		/** Compares the given SmallVectors
+		 *
+		 * @param	lhs the first SmallVector to compare
+		 * @param	rhs the second SmallVector to compare
+		 * @return	true if both SmallVector are different, false otherwise */
+		friend bool operator!=(const SmallVector& lhs, const SmallVector& rhs)
+		{ return !(lhs == rhs); };
+
+		/** @return	the initial iterator of the SmallVector */
+		iterator begin() { return mElements; };
+
+		/** @return	the initial iterator of the SmallVector */
+		const_iterator begin() const { return mElements; };
+
+		/** @return	the final iterator of the SmallVector */
+		iterator end() { return mElements + mNumElements; };
+
+		/** @return	the final iterator of the SmallVector */
+		const_iterator end() const { return mElements + mNumElements; };
+
+		/** @return	the initial reverse iterator of the SmallVector */
+		reverse_iterator rbegin() { return reverse_iterator(end()); };
+
+		/** @return	the initial reverse iterator of the SmallVector */
+		const_reverse_iterator rbegin() const
+		{ return const_reverse_iterator(end()); };
+
+		/** @return	the final reverse iterator of the SmallVector */
+		reverse_iterator rend() { return reverse_iterator(begin()); };
+
+		/** @return	the final reverse iterator of the SmallVector */
+		const_reverse_iterator rend() const
+		{ return const_reverse_iterator(begin()); };
+
+		/** @return	the number of Elements in the SmallVector */
+		size_type size() const { return mNumElements; };
+
+		/** @return	the number of Elements that can be stored in the
+		 *			SmallVector without moving them to a larger buffer */
+		size_type capacity() const { return mCapacity; };
+
+		/** @return	true if the SmallVector has no Elements inside, false
+		 *			otherwise */
+		bool empty() const { return (mNumElements == 0); };
+
+		/** @return	true if the Elements are stored inside the SmallVector,
+		 *			false if they have been moved to the heap */
+		bool isInline() const
+		{ return mElements == reinterpret_cast<const T*>(mInlineData); };
+
+		/** @return	the memory used by the SmallVector. The reserved bytes
+		 *			include the ones of its internal array */
+		MemoryStats getMemoryStats() const;
+
+		/** @return	a reference to the first element in the SmallVector
+		 * @note	if the SmallVector is empty, it causes undefined
+		 *			behavior */
+		T& front() { return mElements[0]; };
+
+		/** @return	a reference to the first element in the SmallVector
+		 * @note	if the SmallVector is empty, it causes undefined
+		 *			behavior */
+		const T& front() const { return mElements[0]; };
+
+		/** @return	a reference to the last element in the SmallVector
+		 * @note	if the SmallVector is empty, it causes undefined
+		 *			behavior */
+		T& back() { return mElements[mNumElements - 1]; };
+
+		/** @return	a reference to the last element in the SmallVector
+		 * @note	if the SmallVector is empty, it causes undefined
+		 *			behavior */
+		const T& back() const { return mElements[mNumElements - 1]; };
+
+		/** @return	a pointer to the first element stored in the
+		 *			SmallVector */
+		T* data() { return mElements; };
+
+		/** @return	a pointer to the first element stored in the
+		 *			SmallVector */
+		const T* data() const { return mElements; };
+
+		/** Changes the SmallVector capacity so it can be added up to the
+		 * given elements without moving them
+		 *
+		 * @param	n the new minimum capacity of the SmallVector */
+		void reserve(size_type n);
+
+		/** Moves the Elements to a buffer of the same size than the number
+		 * of Elements, or inside the SmallVector if they fit */
+		void shrink_to_fit();
+
+		/** Removes all the elements in the SmallVector
+		 * @note	the capacity of the SmallVector won't change */
+		void clear();
+
+		/** Changes the number of elements stored in the SmallVector
+		 *
+		 * @param	numElements the new number of elements stored inside the
+		 *			SmallVector
+		 * @param	value the initial value with which the new values will be
+		 *			intialized */
+		void resize(size_type numElements, const T& value = T());
+
+		/** Adds a new Element at the back of the SmallVector
+		 *
+		 * @param	element the Element to push at the back of the
+		 *			SmallVector */
+		void push_back(const T& element);
+
+		/** Adds a new Element at the back of the SmallVector
+		 *
+		 * @param	args the arguments needed for calling the constructor of
+		 *			the new Element
+		 * @return	a reference to the new element */
+		template <typename... Args>
+		T& emplace_back(Args&&... args);
+
+		/** Removes the last Element of the SmallVector
+		 * @note	if the SmallVector is empty, it causes undefined
+		 *			behavior */
+		void pop_back();
+
+		/** Inserts the given element into the SmallVector at the position
+		 * located at the given iterator
+		 *
+		 * @param	it an iterator to the position to insert the element
+		 * @param	value the element to insert
+		 * @return	an iterator to the inserted element
+		 * @note	the next stored elements will be displaced one position
+		 *			right inside the SmallVector */
+		iterator insert(const_iterator it, const T& value);
+		iterator insert(const_iterator it, T&& value)
+		{ return emplace(it, std::move(value)); };
+
+		/** Inserts the given element into the SmallVector at the position
+		 * located at the given iterator
+		 *
+		 * @param	it an iterator to the position to insert the element
+		 * @param	args the arguments needed for calling the constructor of
+		 *			the new Element
+		 * @return	an iterator to the inserted element
+		 * @note	the next stored elements will be displaced one position
+		 *			right inside the SmallVector */
+		template <typename... Args>
+		iterator emplace(const_iterator it, Args&&... args);
+
+		/** Inserts the elements of the given range into the SmallVector at
+		 * the position located at the given iterator
+		 *
+		 * @param	it an iterator to the position to insert the elements
+		 * @param	first the first iterator of the range to insert
+		 * @param	last the past-the-end iterator of the range to insert
+		 * @return	an iterator to the first inserted element
+		 * @note	the next stored elements will be displaced only once. The
+		 *			range mustn't be part of the SmallVector */
+		template <typename InputIterator, typename = typename
+			std::iterator_traits<InputIterator>::iterator_category
+		>
+		iterator insert(
+			const_iterator it, InputIterator first, InputIterator last
+		);
+
+		/** Inserts copies of the given element into the SmallVector at the
+		 * position located at the given iterator
+		 *
+		 * @param	it an iterator to the position to insert the elements
+		 * @param	count the number of copies to insert
+		 * @param	value the element to insert
+		 * @return	an iterator to the first inserted element
+		 * @note	the next stored elements will be displaced only once */
+		iterator insert(const_iterator it, size_type count, const T& value);
+
+		/** Inserts the given elements into the SmallVector at the position
+		 * located at the given iterator
+		 *
+		 * @param	it an iterator to the position to insert the elements
+		 * @param	list the elements to insert
+		 * @return	an iterator to the first inserted element */
+		iterator insert(const_iterator it, std::initializer_list<T> list)
+		{ return insert(it, list.begin(), list.end()); };
+
+		/** Replaces the elements of the SmallVector with the ones of the
+		 * given range
+		 *
+		 * @param	first the first iterator of the range to copy
+		 * @param	last the past-the-end iterator of the range to copy */
+		template <typename InputIterator, typename = typename
+			std::iterator_traits<InputIterator>::iterator_category
+		>
+		void assign(InputIterator first, InputIterator last)
+		{ clear(); insert(end(), first, last); }
+
+		/** Replaces the elements of the SmallVector with copies of the given
+		 * one
+		 *
+		 * @param	count the number of copies
+		 * @param	value the element to copy */
+		void assign(size_type count, const T& value)
+		{ clear(); resize(count, value); };
+
+		/** Replaces the elements of the SmallVector with the given ones
+		 *
+		 * @param	list the elements to copy */
+		void assign(std::initializer_list<T> list)
+		{ assign(list.begin(), list.end()); };
+
+		/** Adds the elements of the given range at the back of the
+		 * SmallVector
+		 *
+		 * @param	range the range with the elements to add */
+		template <typename R>
+		void append_range(R&& range)
+		{ insert(end(), std::begin(range), std::end(range)); }
+
+		/** Removes the element located at the given iterator from the
+		 * SmallVector
+		 *
+		 * @param	it an iterator to the Element
+		 * @return	an iterator to the next Element
+		 * @note	the next stored elements will be displaced one position
+		 *			left inside the SmallVector */
+		iterator erase(const_iterator it);
+	private:
+		/** @return	the capacity to use for storing at least the given number
+		 *			of Elements */
+		size_type getGrowCapacity(size_type minCapacity) const;
+
+		/** Moves the elements located at the given iterator and after it
+		 * the given number of positions to the right
+		 *
+		 * @param	it an iterator to the first element to move
+		 * @param	count the number of positions to move the elements. There
+		 *			must be enough capacity for them
+		 * @return	the number of positions of the gap left that still hold
+		 *			(moved-from) elements, the rest must be constructed
+		 * @note	the number of elements isn't updated */
+		size_type shiftTail(iterator it, size_type count);
+
+		/** Moves the Elements to the given buffer, releasing the memory of
+		 * the current one
+		 *
+		 * @param	buffer the new buffer of the Elements. It can be
+		 *			@see mInlineData or a heap buffer
+		 * @param	capacity the number of Elements of the new buffer */
+		void relocate(T* buffer, size_type capacity);
+
+		/** Moves the Elements of the given SmallVector to the current one,
+		 * which must be empty and without heap memory
+		 *
+		 * @param	other the SmallVector whose Elements will be moved */
+		void steal(SmallVector& other);
+	};
+
+}
+
+#include "SmallVector.hpp"
+
+#endif		// STDEXT_SMALL_VECTOR_H
@@ -0,0 +1,403 @@
+#ifndef STDEXT_SMALL_VECTOR_HPP
+#define STDEXT_SMALL_VECTOR_HPP
+
+#include <cstring>
+#include <algorithm>
+
+namespace stdext {
+
+	template <typename T, std::size_t N, typename A>
+	SmallVector<T, N, A>::SmallVector(const SmallVector& other) : SmallVector()
+	{
+		reserve(other.mNumElements);
+		if constexpr (std::is_trivially_copyable_v<T>) {
+			if (other.mNumElements > 0) {
+				std::memcpy(mElements, other.mElements, other.mNumElements * sizeof(T));
+			}
+		}
+		else {
+			std::uninitialized_copy(other.begin(), other.end(), mElements);
+		}
+		mNumElements = other.mNumElements;
+	}
+
+
+	template <typename T, std::size_t N, typename A>
+	SmallVector<T, N, A>::SmallVector(SmallVector&& other) : SmallVector()
+	{
+		steal(other);
+	}
+
+
+	template <typename T, std::size_t N, typename A>
+	template <typename InputIterator, typename>
+	SmallVector<T, N, A>::SmallVector(InputIterator first, InputIterator last) : SmallVector()
+	{
+		insert(end(), first, last);
+	}
+
+
+	template <typename T, std::size_t N, typename A>
+	SmallVector<T, N, A>::~SmallVector()
+	{
+		clear();
+		if (!isInline()) {
+			mAllocator.deallocate(mElements, mCapacity);
+		}
+	}
+
+
+	template <typename T, std::size_t N, typename A>
+	SmallVector<T, N, A>& SmallVector<T, N, A>::operator=(const SmallVector& other)
+	{
+		if (this != &other) {
+			clear();
+			reserve(other.mNumElements);
+			if constexpr (std::is_trivially_copyable_v<T>) {
+				if (other.mNumElements > 0) {
+					std::memcpy(mElements, other.mElements, other.mNumElements * sizeof(T));
+				}
+			}
+			else {
+				std::uninitialized_copy(other.begin(), other.end(), mElements);
+			}
+			mNumElements = other.mNumElements;
+		}
+
+		return *this;
+	}
+
+
+	template <typename T, std::size_t N, typename A>
+	SmallVector<T, N, A>& SmallVector<T, N, A>::operator=(SmallVector&& other)
+	{
+		if (this != &other) {
+			clear();
+			if (!isInline()) {
+				mAllocator.deallocate(mElements, mCapacity);
+				mElements = reinterpret_cast<T*>(mInlineData);
+				mCapacity = N;
+			}
+			steal(other);
+		}
+
+		return *this;
+	}
+
+
+	template <typename T, std::size_t N, typename A>
+	MemoryStats SmallVector<T, N, A>::getMemoryStats() const
+	{
+		MemoryStats stats;
+		stats.numAllocations = isInline()? 0 : 1;
+		stats.reservedBytes = N * sizeof(T) + (isInline()? 0 : mCapacity * sizeof(T));
+		stats.liveBytes = mNumElements * sizeof(T);
+		stats.numElements = mNumElements;
+		return stats;
+	}
+
+
+	template <typename T, std::size_t N, typename A>
+	void SmallVector<T, N, A>::reserve(size_type n)
+	{
+		if (n > mCapacity) {
+			relocate(mAllocator.allocate(n), n);
+		}
+	}
+
+
+	template <typename T, std::size_t N, typename A>
+	void SmallVector<T, N, A>::shrink_to_fit()
+	{
+		if (!isInline() && (mNumElements < mCapacity)) {
+			if (mNumElements <= N) {
+				relocate(reinterpret_cast<T*>(mInlineData), N);
+			}
+			else {
+				relocate(mAllocator.allocate(mNumElements), mNumElements);
+			}
+		}
+	}
+
+
+	template <typename T, std::size_t N, typename A>
+	void SmallVector<T, N, A>::clear()
+	{
+		std::destroy(begin(), end());
+		mNumElements = 0;
+	}
+
+
+	template <typename T, std::size_t N, typename A>
+	void SmallVector<T, N, A>::resize(size_type numElements, const T& value)
+	{
+		if (numElements < mNumElements) {
+			std::destroy(begin() + numElements, end());
+		}
+		else if (numElements > mNumElements) {
+			if (numElements > mCapacity) {
+				// The value could be stored in the SmallVector
+				T valueCopy = value;
+				reserve(getGrowCapacity(numElements));
+				std::uninitialized_fill(end(), begin() + numElements, valueCopy);
+			}
+			else {
+				std::uninitialized_fill(end(), begin() + numElements, value);
+			}
+		}
+		mNumElements = numElements;
+	}
+
+
+	template <typename T, std::size_t N, typename A>
+	void SmallVector<T, N, A>::push_back(const T& element)
+	{
+		emplace_back(element);
+	}
+
+
+	template <typename T, std::size_t N, typename A>
+	template <typename... Args>
+	T& SmallVector<T, N, A>::emplace_back(Args&&... args)
+	{
+		if (mNumElements == mCapacity) {
+			// The new Element is constructed before moving the old ones,
+			// since the arguments could reference them
+			size_type capacity = getGrowCapacity(mNumElements + 1);
+			T* buffer = mAllocator.allocate(capacity);
+			try {
+				new (buffer + mNumElements) T(std::forward<Args>(args)...);
+			}
+			catch (...) {
+				mAllocator.deallocate(buffer, capacity);
+				throw;
+			}
+			relocate(buffer, capacity);
+		}
+		else {
+			new (mElements + mNumElements) T(std::forward<Args>(args)...);
+		}
+		mNumElements++;
+
+		return mElements[mNumElements - 1];
+	}
+
+
+	template <typename T, std::size_t N, typename A>
+	void SmallVector<T, N, A>::pop_back()
+	{
+		back().~T();
+		mNumElements--;
+	}
+
+
+	template <typename T, std::size_t N, typename A>
+	typename SmallVector<T, N, A>::iterator SmallVector<T, N, A>::insert(const_iterator it, const T& value)
+	{
+		return emplace(it, value);
+	}
+
+
+	template <typename T, std::size_t N, typename A>
+	template <typename... Args>
+	typename SmallVector<T, N, A>::iterator SmallVector<T, N, A>::emplace(const_iterator it, Args&&... args)
+	{
+		size_type position = it - begin();
+		if (position == mNumElements) {
+			emplace_back(std::forward<Args>(args)...);
+			return begin() + position;
+		}
+
+		// The value is constructed first since the arguments could
+		// reference the Elements of the SmallVector
+		T value(std::forward<Args>(args)...);
+		if (mNumElements == mCapacity) {
+			reserve(getGrowCapacity(mNumElements + 1));
+		}
+
+		iterator itCopy = begin() + position;
+		if constexpr (std::is_trivially_copyable_v<T>) {
+			std::memmove(itCopy + 1, itCopy, (end() - itCopy) * sizeof(T));
+			std::memcpy(itCopy, &value, sizeof(T));
+			mNumElements++;
+		}
+		else {
+			emplace_back( std::move(back()) );
+			std::move_backward(itCopy, end() - 2, end() - 1);
+			*itCopy = std::move(value);
+		}
+
+		return itCopy;
+	}
+
+
+	template <typename T, std::size_t N, typename A>
+	template <typename InputIterator, typename>
+	typename SmallVector<T, N, A>::iterator SmallVector<T, N, A>::insert(
+		const_iterator it, InputIterator first, InputIterator last
+	) {
+		if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+			typename std::iterator_traits<InputIterator>::iterator_category>
+		) {
+			size_type count = std::distance(first, last);
+			size_type position = it - begin();
+			if (mNumElements + count > mCapacity) {
+				reserve(getGrowCapacity(mNumElements + count));
+			}
+			iterator itCopy = begin() + position;
+
+			size_type numConstructed = shiftTail(itCopy, count);
+			if constexpr (std::is_trivially_copyable_v<T>) {
+				std::uninitialized_copy_n(first, count, itCopy);
+			}
+			else {
+				for (size_type i = 0; i < count; ++i, ++first) {
+					if (i < numConstructed) {
+						itCopy[i] = *first;
+					}
+					else {
+						new (itCopy + i) T(*first);
+					}
+				}
+			}
+			mNumElements += count;
+
+			return itCopy;
+		}
+		else {
+			// The size of the range is unknown, so the elements are added
+			// at the back and then rotated into place
+			size_type position = it - begin(), oldSize = mNumElements;
+			for (; first != last; ++first) {
+				emplace_back(*first);
+			}
+			std::rotate(begin() + position, begin() + oldSize, end());
+
+			return begin() + position;
+		}
+	}
+
+
+	template <typename T, std::size_t N, typename A>
+	typename SmallVector<T, N, A>::iterator SmallVector<T, N, A>::insert(
+		const_iterator it, size_type count, const T& value
+	) {
+		// The value is copied first since it could be stored in the
+		// SmallVector
+		T valueCopy = value;
+		size_type position = it - begin();
+		if (mNumElements + count > mCapacity) {
+			reserve(getGrowCapacity(mNumElements + count));
+		}
+		iterator itCopy = begin() + position;
+
+		size_type numConstructed = shiftTail(itCopy, count);
+		std::fill_n(itCopy, numConstructed, valueCopy);
+		std::uninitialized_fill_n(itCopy + numConstructed, count - numConstructed, valueCopy);
+		mNumElements += count;
+
+		return itCopy;
+	}
+
+
+	template <typename T, std::size_t N, typename A>
+	typename SmallVector<T, N, A>::iterator SmallVector<T, N, A>::erase(const_iterator it)
+	{
+		iterator itCopy = begin() + (it - begin());
+
+		if (itCopy != end()) {
+			if constexpr (std::is_trivially_copyable_v<T>) {
+				std::memmove(itCopy, itCopy + 1, (end() - itCopy - 1) * sizeof(T));
+				mNumElements--;
+			}
+			else {
+				std::move(itCopy + 1, end(), itCopy);
+				pop_back();
+			}
+		}
+
+		return itCopy;
+	}
+
+
+	template <typename T, std::size_t N, typename A>
+	typename SmallVector<T, N, A>::size_type SmallVector<T, N, A>::getGrowCapacity(size_type minCapacity) const
+	{
+		return std::max(minCapacity, 2 * mCapacity);
+	}
+
+
+	template <typename T, std::size_t N, typename A>
+	typename SmallVector<T, N, A>::size_type SmallVector<T, N, A>::shiftTail(iterator it, size_type count)
+	{
+		size_type numTail = end() - it;
+		if ((count == 0) || (numTail == 0)) {
+			return 0;
+		}
+
+		if constexpr (std::is_trivially_copyable_v<T>) {
+			std::memmove(it + count, it, numTail * sizeof(T));
+			return 0;
+		}
+		else {
+			// The last elements are moved to the unconstructed positions
+			// and the remaining ones over the moved-from elements
+			size_type numToRaw = std::min(count, numTail);
+			std::uninitialized_move(end() - numToRaw, end(), end() + count - numToRaw);
+			std::move_backward(it, end() - numToRaw, end() + count - numToRaw);
+			return numToRaw;
+		}
+	}
+
+
+	template <typename T, std::size_t N, typename A>
+	void SmallVector<T, N, A>::relocate(T* buffer, size_type capacity)
+	{
+		if constexpr (std::is_trivially_copyable_v<T>) {
+			if (mNumElements > 0) {
+				std::memcpy(buffer, mElements, mNumElements * sizeof(T));
+			}
+		}
+		else {
+			std::uninitialized_move(begin(), end(), buffer);
+			std::destroy(begin(), end());
+		}
+
+		if (!isInline()) {
+			mAllocator.deallocate(mElements, mCapacity);
+		}
+
+		mElements = buffer;
+		mCapacity = capacity;
+	}
+
+
+	template <typename T, std::size_t N, typename A>
+	void SmallVector<T, N, A>::steal(SmallVector& other)
+	{
+		if (other.isInline()) {
+			if constexpr (std::is_trivially_copyable_v<T>) {
+				if (other.mNumElements > 0) {
+					std::memcpy(mElements, other.mElements, other.mNumElements * sizeof(T));
+				}
+			}
+			else {
+				std::uninitialized_move(other.begin(), other.end(), mElements);
+			}
+			mNumElements = other.mNumElements;
+			other.clear();
+		}
+		else {
+			mElements = other.mElements;
+			mNumElements = other.mNumElements;
+			mCapacity = other.mCapacity;
+
+			other.mElements = reinterpret_cast<T*>(other.mInlineData);
+			other.mNumElements = 0;
+			other.mCapacity = N;
+		}
+	}
+
+}
+
+#endif		// STDEXT_SMALL_VECTOR_HPP
@@ -0,0 +1,168 @@
+#ifndef STDEXT_SPARSE_SET_H
+#define STDEXT_SPARSE_SET_H
+
+#include <limits>
+#include <vector>
+
+namespace stdext {
+
+	/**
+	 * Class SparseSet, it's a container of elements of type @tparam T
+	 * accessed by stable indices like a ReleaseVector, but that stores the
+	 * elements contiguously without any gaps. The elements are kept in a
+	 * dense array, and a sparse array maps each index to the position of its
+	 * element in the dense one. When an element is removed, the last one is
+	 * moved to its position, so the iteration is a plain loop over the dense
+	 * array. The indices can be generated by the SparseSet or given by the
+	 * user, for example the indices of a ReleaseVector. All the memory
+	 * allocation of the elements will be done using the allocator @tparam A.
+	 *
+	 * @note	removing an element changes the order of the others and
+	 *			invalidates the iterators and pointers to the last element
+	 */
+	template <typename T, typename A = std::allocator<T>>
+	class SparseSet
+	{
+	public:		// Nested types
+		using size_type			= std::size_t;
+		using value_type		= T;
+		using pointer			= T*;
+		using reference			= T&;
+		using iterator			= typename std::vector<T, A>::iterator;
+		using const_iterator	= typename std::vector<T, A>::const_iterator;
+
+		/** The dense position of the indices without element */
+		static constexpr size_type npos = std::numeric_limits<size_type>::max();
+
+	private:	// Attributes
+		/** The elements of the SparseSet, stored contiguously */
+		std::vector<T, A> mValues;
+
+		/** The index of each of the elements of @see mValues */
+		std::vector<size_type> mDenseIndices;
+
+		/** The position in @see mValues of the element of each index, or
+		 * @see npos if it doesn't have any */
+		std::vector<size_type> mDensePositions;
+
+		/** The indices released by @see erase that can be reused by
+		 * @see emplace */
+		std::vector<size_type> mReleasedIndices;
+
+	public:		// Functions
+		/** Returns the element with the given index
+		 *
+		 * @param	index the index of the element
+		 * @return	a reference to the element
+		 * @note	if there is no element with the index, it causes
+		 *			undefined behavior */
+		T& operator[](size_type index)
+		{ return mValues[mDensePositions[index]]; };
+
+		/** Returns the element with the given index
+		 *
+		 * @param	index the index of the element
+		 * @return	a const reference to the element
+		 * @note	if there is no element with the index, it causes
+		 *			undefined behavior */
+		const T& operator[](size_type index) const
+		{ return mValues[mDensePositions[index]]; };
+
+		/** @return	the initial iterator of the SparseSet */
+		iterator begin() { return mValues.begin(); };
+
+		/** @return	the initial iterator of the SparseSet */
+		const_iterator begin() const { return mValues.begin(); };
+
+		/** @return	the past the end iterator of the SparseSet */
+		iterator end() { return mValues.end(); };
+
+		/** @return	the past the end iterator of the SparseSet */
+		const_iterator end() const { return mValues.end(); };
+
+		/** @return	the number of elements in the SparseSet */
+		size_type size() const { return mValues.size(); };
+
+		/** @return	true if the SparseSet has no elements inside, false
+		 *			otherwise */
+		bool empty() const { return mValues.empty(); };
+
+		/** @return	a pointer to the dense array of elements */
+		T* data() { return mValues.data(); };
+
+		/** @return	a pointer to the dense array of elements */
+		const T* data() const { return mValues.data(); };
+
+		/** @return	a pointer to the indices of the elements, in the same
+		 *			order than @see data */
+		const size_type* indices() const { return mDenseIndices.data(); };
+
+		/** Returns the index of the element pointed by the given iterator
+		 *
+		 * @param	it an iterator to the element
+		 * @return	the index of the element */
+		size_type getIndex(const_iterator it) const
+		{ return mDenseIndices[it - mValues.begin()]; };
+
+		/** Changes the SparseSet capacity so it can be added up to the
+		 * given elements without reallocating
+		 *
+		 * @param	n the new minimum capacity of the SparseSet */
+		void reserve(size_type n);
+
+		/** Removes all the elements in the SparseSet */
+		void clear();
+
+		/** Checks if there is an element with the given index
+		 *
+		 * @param	index the index of the element
+		 * @return	true if there is an element, false otherwise */
+		bool contains(size_type index) const;
+
+		/** Searchs the element with the given index
+		 *
+		 * @param	index the index of the element
+		 * @return	an iterator to the element, end if it wasn't found */
+		iterator find(size_type index);
+
+		/** Searchs the element with the given index
+		 *
+		 * @param	index the index of the element
+		 * @return	a const_iterator to the element, end if it wasn't
+		 *			found */
+		const_iterator find(size_type index) const;
+
+		/** Creates a new element with a new index, reusing the indices of the
+		 * removed elements if possible
+		 *
+		 * @param	args the arguments needed for calling the constructor of
+		 *			the new element
+		 * @return	the index of the new element */
+		template <typename... Args>
+		size_type emplace(Args&&... args);
+
+		/** Creates a new element with the given index. If there was already
+		 * an element with the index, it will be replaced
+		 *
+		 * @param	index the index of the element, for example the index of
+		 *			an element of a ReleaseVector
+		 * @param	args the arguments needed for calling the constructor of
+		 *			the new element
+		 * @return	a reference to the new element */
+		template <typename... Args>
+		T& emplaceAt(size_type index, Args&&... args);
+
+		/** Removes the element with the given index, moving the last element
+		 * of the dense array to its position
+		 *
+		 * @param	index the index of the element to remove
+		 * @return	true if the element was removed, false if there wasn't
+		 *			any element with the index */
+		bool erase(size_type index);
+	};
+
+}
+
+#include "SparseSet.hpp"
+
+#endif		// STDEXT_SPARSE_SET_H
@@ -0,0 +1,113 @@
+#ifndef STDEXT_SPARSE_SET_HPP
+#define STDEXT_SPARSE_SET_HPP
+
+#include <utility>
+
+namespace stdext {
+
+	template <typename T, typename A>
+	void SparseSet<T, A>::reserve(size_type n)
+	{
+		mValues.reserve(n);
+		mDenseIndices.reserve(n);
+		mDensePositions.reserve(n);
+	}
+
+
+	template <typename T, typename A>
+	void SparseSet<T, A>::clear()
+	{
+		mValues.clear();
+		mDenseIndices.clear();
+		mDensePositions.clear();
+		mReleasedIndices.clear();
+	}
+
+
+	template <typename T, typename A>
+	bool SparseSet<T, A>::contains(size_type index) const
+	{
+		return (index < mDensePositions.size()) && (mDensePositions[index] != npos);
+	}
+
+
+	template <typename T, typename A>
+	typename SparseSet<T, A>::iterator SparseSet<T, A>::find(size_type index)
+	{
+		return contains(index)? mValues.begin() + mDensePositions[index] : mValues.end();
+	}
+
+
+	template <typename T, typename A>
+	typename SparseSet<T, A>::const_iterator SparseSet<T, A>::find(size_type index) const
+	{
+		return contains(index)? mValues.begin() + mDensePositions[index] : mValues.end();
+	}
+
+
+	template <typename T, typename A>
+	template <typename... Args>
+	typename SparseSet<T, A>::size_type SparseSet<T, A>::emplace(Args&&... args)
+	{
+		// The released indices could have been reused with emplaceAt
+		size_type index = mDensePositions.size();
+		while (!mReleasedIndices.empty()) {
+			size_type releasedIndex = mReleasedIndices.back();
+			mReleasedIndices.pop_back();
+			if (!contains(releasedIndex)) {
+				index = releasedIndex;
+				break;
+			}
+		}
+
+		emplaceAt(index, std::forward<Args>(args)...);
+		return index;
+	}
+
+
+	template <typename T, typename A>
+	template <typename... Args>
+	T& SparseSet<T, A>::emplaceAt(size_type index, Args&&... args)
+	{
+		if (contains(index)) {
+			T& value = mValues[mDensePositions[index]];
+			value = T(std::forward<Args>(args)...);
+			return value;
+		}
+
+		if (index >= mDensePositions.size()) {
+			mDensePositions.resize(index + 1, npos);
+		}
+
+		mDensePositions[index] = mValues.size();
+		mDenseIndices.push_back(index);
+		return mValues.emplace_back(std::forward<Args>(args)...);
+	}
+
+
+	template <typename T, typename A>
+	bool SparseSet<T, A>::erase(size_type index)
+	{
+		if (!contains(index)) {
+			return false;
+		}
+
+		size_type position = mDensePositions[index];
+		size_type lastPosition = mValues.size() - 1;
+		if (position != lastPosition) {
+			mValues[position] = std::move(mValues[lastPosition]);
+			mDenseIndices[position] = mDenseIndices[lastPosition];
+			mDensePositions[mDenseIndices[position]] = position;
+		}
+
+		mValues.pop_back();
+		mDenseIndices.pop_back();
+		mDensePositions[index] = npos;
+		mReleasedIndices.push_back(index);
+
+		return true;
+	}
+
+}
+
+#endif		// STDEXT_SPARSE_SET_HPP
@@ -57,6 +57,13 @@ namespace stdext {
 		/** Class destructor. It stops all the threads */
 		~ThreadPool();
 
+		/** @return	the number of execution threads of the ThreadPool */
+		std::size_t getNumThreads() const { return mNumThreads; };
+
+		/** @return	true if the calling thread is one of the execution
+		 *			threads of the ThreadPool, false otherwise */
+		bool isPoolThread() const;
+
 		/** Executes the given function asynchronously
 		 *
 		 * @param	function the function to execute. It will be submitted to
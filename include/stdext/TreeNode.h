@@ -1,8 +1,10 @@
 #ifndef STDEXT_TREE_NODE_H
 #define STDEXT_TREE_NODE_H
 
-#include <deque>
+#include <vector>
 #include <memory>
+#include <memory_resource>
+#include "MemoryStats.h"
 
 namespace stdext {
 
@@ -19,6 +21,8 @@ namespace stdext {
 	 * requirements.
 	 * The TreeNode also has functions for iterating it with different
 	 * algorithms and also finding Nodes by the data that each one hold.
+	 * The descendant TreeNodes can be allocated from a memory resource, so
+	 * a whole tree can be stored in a few large blocks of memory.
 	 */
 	template <typename T>
 	class TreeNode
@@ -30,15 +34,51 @@ namespace stdext {
 		template <Traversal t> using iterator = TNIterator<false, t>;
 		template <Traversal t> using const_iterator = TNIterator<true, t>;
 
+		/** The buffer used by the BFS iterators for storing the TreeNodes
+		 * whose children are pending to visit. It can be reused between
+		 * traversals so they don't allocate memory once it has grown */
+		using BFSBuffer = std::vector<const TreeNode*>;
+
+		/** Struct NodeDeleter, destroys the descendant TreeNodes and releases
+		 * their memory with the memory resource used for allocating them.
+		 * The memory resource is read from the TreeNode itself, so the
+		 * owning pointers don't grow */
+		struct NodeDeleter
+		{
+			/** Destroys the given TreeNode and releases its memory
+			 *
+			 * @param	node a pointer to the TreeNode to destroy */
+			void operator()(TreeNode* node) const;
+		};
+
+		using NodePtr = std::unique_ptr<TreeNode, NodeDeleter>;
+
 	private:	// Attributes
 		/** A pointer to the parent TreeNode of the current one */
 		TreeNode* mParent = nullptr;
 
 		/** A pointer to the child TreeNode of the current one */
-		std::unique_ptr<TreeNode> mChild;
+		NodePtr mChild;
+
+		/** A pointer to the last child TreeNode of the current one, used for
+		 * adding new children in O(1) time */
+		TreeNode* mLastChild = nullptr;
 
 		/** A pointer to the sibling TreeNode of the current one */
-		std::unique_ptr<TreeNode> mSibling;
+		NodePtr mSibling;
+
+		/** A pointer to the previous sibling TreeNode of the current one,
+		 * used for removing the TreeNode in O(1) time */
+		TreeNode* mPrevSibling = nullptr;
+
+		/** The memory resource used for allocating the descendants created
+		 * with @see emplace, nullptr if they must be allocated with new */
+		std::pmr::memory_resource* mResource = nullptr;
+
+		/** The memory resource used for allocating the current TreeNode,
+		 * nullptr if it was allocated with new or it isn't owned by a
+		 * NodePtr. It isn't transferred with copies nor moves */
+		std::pmr::memory_resource* mAllocResource = nullptr;
 
 		/** The data of the TreeNode */
 		T mData;
@@ -61,16 +101,26 @@ namespace stdext {
 		 *
 		 * @param	other the other TreeNode to copy */
 		TreeNode(const TreeNode& other);
-		TreeNode(TreeNode&& other) = default;
+
+		/** Move constructor
+		 *
+		 * @param	other the other TreeNode to move */
+		TreeNode(TreeNode&& other)
+			noexcept(std::is_nothrow_move_constructible_v<T>);
 
 		/** Class destructor */
-		~TreeNode() = default;
+		~TreeNode();
 
 		/** Assignment operator
 		 *
 		 * @param	other the other TreeNode to copy */
 		TreeNode& operator=(const TreeNode& other);
-		TreeNode& operator=(TreeNode&& other) = default;
+
+		/** Move assignment operator
+		 *
+		 * @param	other the other TreeNode to move */
+		TreeNode& operator=(TreeNode&& other)
+			noexcept(std::is_nothrow_move_assignable_v<T>);
 
 		/** Compares the given TreeNodes
 		 *
@@ -96,6 +146,26 @@ namespace stdext {
 		template <Traversal t = Traversal::BFS>
 		const_iterator<t> cbegin() const { return const_iterator<t>(this); }
 
+		/** @param	buffer the buffer used by the iterator for storing the
+		 *			TreeNodes pending to visit, it will be cleared
+		 * @return	the initial BFS iterator of the TreeNode descendants
+		 * @note	the buffer must outlive the iterator, and it keeps its
+		 *			capacity, so it can be reused for not allocating memory
+		 *			in later traversals. The copies of the iterator use
+		 *			their own queue instead */
+		iterator<Traversal::BFS> begin(BFSBuffer& buffer)
+		{ return iterator<Traversal::BFS>(this, &buffer); };
+
+		/** @param	buffer the buffer used by the iterator for storing the
+		 *			TreeNodes pending to visit, it will be cleared
+		 * @return	the initial BFS iterator of the TreeNode descendants
+		 * @note	the buffer must outlive the iterator, and it keeps its
+		 *			capacity, so it can be reused for not allocating memory
+		 *			in later traversals. The copies of the iterator use
+		 *			their own queue instead */
+		const_iterator<Traversal::BFS> cbegin(BFSBuffer& buffer) const
+		{ return const_iterator<Traversal::BFS>(this, &buffer); };
+
 		/** @return	the final iterator of the TreeNode */
 		template <Traversal t = Traversal::BFS>
 		iterator<t> end() { return iterator<t>(); }
@@ -119,12 +189,42 @@ namespace stdext {
 		/** @return	a pointer to the child TreeNode of the current one */
 		const TreeNode* getChild() const { return mChild.get(); };
 
+		/** @return	a pointer to the last child TreeNode of the current one */
+		TreeNode* getLastChild() { return mLastChild; };
+
+		/** @return	a pointer to the last child TreeNode of the current one */
+		const TreeNode* getLastChild() const { return mLastChild; };
+
 		/** @return	a pointer to the sibling TreeNode of the current one */
 		TreeNode* getSibling() { return mSibling.get(); };
 
 		/** @return	a pointer to the sibling TreeNode of the current one */
 		const TreeNode* getSibling() const { return mSibling.get(); };
 
+		/** @return	a pointer to the previous sibling TreeNode of the
+		 *			current one */
+		TreeNode* getPrevSibling() { return mPrevSibling; };
+
+		/** @return	a pointer to the previous sibling TreeNode of the
+		 *			current one */
+		const TreeNode* getPrevSibling() const { return mPrevSibling; };
+
+		/** @return	the memory resource used for allocating the descendants
+		 *			of the TreeNode, nullptr if they are allocated with new */
+		std::pmr::memory_resource* getMemoryResource() const
+		{ return mResource; };
+
+		/** Sets the memory resource used for allocating the descendants of
+		 * the TreeNode created with @see emplace. The new descendants also
+		 * use it for allocating their own ones
+		 *
+		 * @param	resource the new memory resource, nullptr for
+		 *			allocating the descendants with new
+		 * @note	the memory resource must outlive the descendants
+		 *			allocated with it. The current descendants aren't moved */
+		void setMemoryResource(std::pmr::memory_resource* resource)
+		{ mResource = resource; };
+
 		/** @return	the data of the TreeNode */
 		T& getData() { return mData; };
 
@@ -132,10 +232,21 @@ namespace stdext {
 		const T& getData() const { return mData; };
 
 		/** @return	the number of TreeNodes in the current tree
-		 *			(current node + descendants) */
+		 *			(current node + descendants)
+		 * @note	the TreeNodes are always counted in DFS pre-order, since
+		 *			it's the fastest traversal without buffer */
 		template <Traversal t = Traversal::BFS>
 		size_type size() const;
 
+		/** @return	the memory used by the current tree (current node +
+		 *			descendants). The Elements are the TreeNodes, and the
+		 *			allocations the descendant ones allocated with new,
+		 *			since the current TreeNode isn't allocated by the tree
+		 *			and the other ones are stored in a memory resource
+		 * @note	the memory allocated by the data of the TreeNodes isn't
+		 *			included */
+		MemoryStats getMemoryStats() const;
+
 		/** Searchs a descendant TreeNode with the same data than the given one
 		 *
 		 * @param	data the data to search in the TreeNode
@@ -152,14 +263,16 @@ namespace stdext {
 		template <Traversal t = Traversal::BFS>
 		const_iterator<t> find(const T& data) const;
 
-		/** Searchs a descendant TreeNode
+		/** Searchs a descendant TreeNode by walking up from it, so it takes
+		 * O(depth) time
 		 *
 		 * @param	node the TreeNode to search
 		 * @return	an iterator to the TreeNode or to end if it wasn't found */
 		template <Traversal t = Traversal::BFS>
 		iterator<t> find(const TreeNode& node);
 
-		/** Searchs a descendant TreeNode
+		/** Searchs a descendant TreeNode by walking up from it, so it takes
+		 * O(depth) time
 		 *
 		 * @param	node the TreeNode to search
 		 * @return	a const_iterator to the TreeNode or to end if it wasn't
@@ -176,12 +289,22 @@ namespace stdext {
 		 * @param	descendant a pointer to the TreeNode to insert
 		 * @return	an iterator to the new TreeNode, end if the TreeNode
 		 *			couldn't be added
-		 * @note	if the parentIt isn't valid the TreeNode won't be added */
+		 * @note	if the parentIt isn't valid the TreeNode won't be added.
+		 *			The TreeNode is added in O(1) time, but the BFS iterator
+		 *			needs the depth of the new TreeNode, so it takes
+		 *			O(depth) time, and it must rebuild its queue the first
+		 *			time that it's incremented */
+		template <Traversal t = Traversal::BFS>
+		iterator<t> insert(const_iterator<t> parentIt, NodePtr descendant);
+
+		/** Adds a descendant TreeNode allocated with new as the last child of
+		 * the TreeNode pointed by the given iterator
+		 * @see insert */
 		template <Traversal t = Traversal::BFS>
 		iterator<t> insert(
 			const_iterator<t> parentIt,
 			std::unique_ptr<TreeNode> descendant
-		);
+		) { return insert(parentIt, NodePtr(descendant.release())); }
 
 		/** Adds a descendant TreeNode as the last child of the TreeNode
 		 * pointed by the given iterator
@@ -193,10 +316,42 @@ namespace stdext {
 		 *			the new Element
 		 * @return	an iterator to the new TreeNode, end if the TreeNode
 		 *			couldn't be added
-		 * @note	if the parentIt isn't valid the TreeNode won't be added */
+		 * @note	if the parentIt isn't valid the TreeNode won't be added.
+		 *			The new TreeNode is allocated with the memory resource of
+		 *			the current one. @see insert for its cost */
 		template <Traversal t = Traversal::BFS, typename... Args>
 		iterator<t> emplace(const_iterator<t> parentIt, Args&&... args);
 
+		/** Adds the given TreeNode as the last child of the current one in
+		 * O(1) time
+		 *
+		 * @param	child a pointer to the TreeNode to insert
+		 * @return	a reference to the new child TreeNode */
+		TreeNode& insertChild(NodePtr child);
+
+		/** Adds a new TreeNode as the last child of the current one in
+		 * O(1) time
+		 *
+		 * @param	args the arguments needed for calling the constructor of
+		 *			the new TreeNode
+		 * @return	a reference to the new child TreeNode
+		 * @note	the new TreeNode is allocated with the memory resource of
+		 *			the current one */
+		template <typename... Args>
+		TreeNode& emplaceChild(Args&&... args)
+		{ return insertChild(createNode(std::forward<Args>(args)...)); }
+
+		/** Forgets all the descendant TreeNodes without destroying them nor
+		 * releasing their memory. It can be used for discarding a tree
+		 * allocated from a memory resource that releases all its memory at
+		 * once (like std::pmr::monotonic_buffer_resource), without visiting
+		 * every TreeNode
+		 *
+		 * @note	T must be trivially destructible, and all the
+		 *			descendants must have been allocated from a memory
+		 *			resource, otherwise their memory would be leaked */
+		void releaseDescendants();
+
 		/** Removes the TreeNode pointed by the given iterator
 		 *
 		 * @param	it an iterator to the TreeNode to remove
@@ -227,18 +382,52 @@ namespace stdext {
 		 * @param	node a pointer to the node that has the childs to move */
 		void moveChildNodesUp(TreeNode* node);
 
-		/** Removes the given node and returns it
+		/** Removes the given node in O(1) time and returns it
 		 *
 		 * @param	node a pointer to the node to remove
 		 * @return	the removed node */
-		std::unique_ptr<TreeNode> removeNode(TreeNode* node);
+		NodePtr removeNode(TreeNode* node);
+
+		/** Appends copies of the descendants of the given TreeNode to the
+		 * current one
+		 *
+		 * @param	other the TreeNode whose descendants will be copied */
+		void copyDescendants(const TreeNode& other);
+
+		/** Destroys all the descendant TreeNodes iteratively */
+		void clearDescendants();
+
+		/** Creates a new TreeNode with @see mResource
+		 *
+		 * @param	args the arguments needed for calling the constructor of
+		 *			the new TreeNode
+		 * @return	the new TreeNode */
+		template <typename... Args>
+		NodePtr createNode(Args&&... args);
+
+		/** Creates an iterator without buffer located at the given
+		 * descendant TreeNode. The depth of the TreeNode is only calculated
+		 * for the BFS iterators
+		 *
+		 * @param	node a pointer to a descendant TreeNode
+		 * @return	the new iterator */
+		template <Traversal t>
+		const_iterator<t> getIterator(const TreeNode* node) const;
 	};
 
 
 	/**
 	 * Class TNIterator, the class used to iterate through the
-	 * descendant TreeNodes of a TreeNode. If a node is removed/added while
-	 * iterating, the iterator will be invalidated
+	 * descendant TreeNodes of a TreeNode. The DFS and Children iterators
+	 * walk the tree with the parent, child and sibling pointers of the
+	 * TreeNodes, so they never allocate memory. The BFS iterators also need
+	 * a queue with the TreeNodes whose children are pending to visit: the
+	 * ones created with a BFSBuffer use it, and the other ones allocate
+	 * their own queue the first time they need it. The copies of a BFS
+	 * iterator always use their own queue, so they can be incremented
+	 * independently.
+	 * If a node is removed/added while iterating, the iterator will be
+	 * invalidated
 	 */
 	template <typename T>
 	template <bool isConst, Traversal t>
@@ -247,6 +436,7 @@ namespace stdext {
 	public:		// Nested types
 		template <bool isConst2, Traversal t2>
 		friend class TNIterator;
+		friend class TreeNode;
 
 		using TreeNodeType = std::conditional_t<isConst,
 			const TreeNode, TreeNode
@@ -259,14 +449,59 @@ namespace stdext {
 		using iterator_category = std::forward_iterator_tag;
 
 	private:	// Attributes
-		/** The deque needed for traversing the TreeNodes */
-		std::deque<TreeNodeType*> mTreeNodeDeque;
+		/** A pointer to the TreeNode that the iterator is pointing at,
+		 * nullptr if it's the end iterator */
+		TreeNodeType* mNode = nullptr;
+
+		/** A pointer to the TreeNode whose descendants are iterated */
+		TreeNodeType* mRoot = nullptr;
+
+		/** The depth of @see mNode relative to @see mRoot. It's only used
+		 * for rebuilding the queue of the BFS iterators */
+		size_type mDepth = 0;
+
+		/** A pointer to the buffer supplied by the user that is used as the
+		 * queue of the BFS iterator, nullptr if it uses @see mOwnBuffer */
+		BFSBuffer* mBuffer = nullptr;
+
+		/** The queue of the BFS iterators without a supplied buffer */
+		BFSBuffer mOwnBuffer;
+
+		/** The position in the queue of the next TreeNode whose children
+		 * must be visited */
+		size_type mBufferHead = 0;
+
+		/** If the queue must be rebuilt before incrementing the iterator,
+		 * because it was created directly at a TreeNode */
+		bool mRebuildBuffer = false;
 
 	public:		// Functions
-		/** Creates a new TNIterator located at the given TreeNode
+		/** Creates a new TNIterator located at the first descendant of the
+		 * given TreeNode
+		 *
+		 * @param	treeNode a pointer to the TreeNode whose descendants
+		 *			are going to be iterated, nullptr for the end iterator
+		 * @param	buffer a pointer to the buffer used by the BFS
+		 *			iterators, it will be cleared. If it's nullptr the
+		 *			iterator will use its own queue */
+		TNIterator(TreeNodeType* treeNode = nullptr, BFSBuffer* buffer = nullptr);
+
+		/** Copy constructor, the pending TreeNodes of the BFS queue are
+		 * copied to the queue of the new TNIterator
+		 *
+		 * @param	other the other TNIterator to copy */
+		TNIterator(const TNIterator& other);
+		TNIterator(TNIterator&& other) = default;
+
+		/** Class destructor */
+		~TNIterator() = default;
+
+		/** Assignment operator, the pending TreeNodes of the BFS queue are
+		 * copied to the queue of the current TNIterator
 		 *
-		 * @param	treeNode a pointer to the TreeNode of the iterator */
-		TNIterator(TreeNodeType* treeNode = nullptr);
+		 * @param	other the other TNIterator to copy */
+		TNIterator& operator=(const TNIterator& other);
+		TNIterator& operator=(TNIterator&& other) = default;
 
 		/** Implicit conversion operator between const TNIterator and non
 		 * const TNIterator
@@ -277,11 +512,11 @@ namespace stdext {
 
 		/** @return	a reference to the current TreeNode that the iterator is
 		 *			pointing at */
-		reference operator*() const { return *mTreeNodeDeque.back(); };
+		reference operator*() const { return *mNode; };
 
 		/** @return	a pointer to the current TreeNode that the iterator is
 		 *			pointing at */
-		pointer operator->() const { return mTreeNodeDeque.back(); };
+		pointer operator->() const { return mNode; };
 
 		/** Compares the given TNIterators
 		 *
@@ -289,7 +524,7 @@ namespace stdext {
 		 * @param	it2 the second TNIterator to compare
 		 * @return	true if both iterators are equal, false otherwise */
 		friend bool operator==(const TNIterator& it1, const TNIterator& it2)
-		{ return (it1.mTreeNodeDeque == it2.mTreeNodeDeque); };
+		{ return (it1.mNode == it2.mNode); };
 
 		/** Compares the given TNIterators
 		 *
@@ -311,6 +546,37 @@ namespace stdext {
 		 *			to the incrementation */
 		TNIterator operator++(int);
 	private:
+		/** Creates a new TNIterator without buffer located at the given
+		 * descendant TreeNode
+		 *
+		 * @param	node a pointer to the TreeNode of the iterator
+		 * @param	root a pointer to the TreeNode whose descendants are
+		 *			iterated
+		 * @param	depth the depth of node relative to root */
+		TNIterator(TreeNodeType* node, TreeNodeType* root, size_type depth) :
+			mNode(node), mRoot(root), mDepth(depth),
+			mRebuildBuffer(t == Traversal::BFS) {};
+
+		/** @return	the queue used by the BFS iterator */
+		BFSBuffer& getBuffer() { return mBuffer? *mBuffer : mOwnBuffer; };
+
+		/** @return	the queue used by the BFS iterator */
+		const BFSBuffer& getBuffer() const
+		{ return mBuffer? *mBuffer : mOwnBuffer; };
+
+		/** Copies the pending TreeNodes of the given BFS queue to
+		 * @see mOwnBuffer
+		 *
+		 * @param	buffer the queue to copy
+		 * @param	bufferHead the position of the first pending TreeNode */
+		void copyPendingNodes(const BFSBuffer& buffer, size_type bufferHead);
+
+		/** Rebuilds the queue of the BFS iterator, so it contains the
+		 * TreeNodes with children that have been visited before
+		 * @see mNode in BFS order but whose children haven't been visited
+		 * yet */
+		void rebuildBuffer();
+
 		/** Calculates the next TreeNode to point using the BFS algorithm */
 		void nextBFS();
 
@@ -324,6 +590,19 @@ namespace stdext {
 
 		/** Calculates the next Children TreeNode to point */
 		void nextChildren();
+
+		/** Calculates the next TreeNode in DFS pre-order without going
+		 * deeper than the given depth
+		 *
+		 * @param	node a pointer to the current TreeNode
+		 * @param	depth the depth of node, it will be updated with the
+		 *			depth of the returned one
+		 * @param	maxDepth the maximum depth of the returned TreeNode
+		 * @return	a pointer to the next TreeNode, nullptr if there are no
+		 *			more TreeNodes */
+		TreeNodeType* nextLimitedPreOrder(
+			TreeNodeType* node, size_type& depth, size_type maxDepth
+		) const;
 	};
 
 }
@@ -3,44 +3,106 @@
 
 namespace stdext {
 
+	template <typename T>
+	void TreeNode<T>::NodeDeleter::operator()(TreeNode* node) const
+	{
+		if (std::pmr::memory_resource* resource = node->mAllocResource) {
+			node->~TreeNode();
+			resource->deallocate(node, sizeof(TreeNode), alignof(TreeNode));
+		}
+		else {
+			delete node;
+		}
+	}
+
+
 	template <typename T>
 	TreeNode<T>::TreeNode(const TreeNode& other) :
 		mParent(nullptr), mData(other.mData)
 	{
-		if (other.mChild) {
-			mChild = std::make_unique<TreeNode>(*other.mChild);
+		copyDescendants(other);
 
-			TreeNode* child = mChild.get();
-			while (child) {
-				child->mParent = this;
-				child = child->mSibling.get();
-			}
+		if (other.mSibling) {
+			mSibling = NodePtr(new TreeNode(*other.mSibling));
+			mSibling->mPrevSibling = this;
 		}
+	}
 
-		if (other.mSibling) {
-			mSibling = std::make_unique<TreeNode>(*other.mSibling);
+
+	template <typename T>
+	TreeNode<T>::TreeNode(TreeNode&& other)
+		noexcept(std::is_nothrow_move_constructible_v<T>) :
+		mParent(other.mParent), mChild(std::move(other.mChild)),
+		mLastChild(other.mLastChild), mSibling(std::move(other.mSibling)),
+		mPrevSibling(other.mPrevSibling), mResource(other.mResource),
+		mData(std::move(other.mData))
+	{
+		other.mLastChild = nullptr;
+
+		TreeNode* child = mChild.get();
+		while (child) {
+			child->mParent = this;
+			child = child->mSibling.get();
+		}
+
+		if (mSibling) {
+			mSibling->mPrevSibling = this;
 		}
 	}
 
 
+	template <typename T>
+	TreeNode<T>::~TreeNode()
+	{
+		clearDescendants();
+	}
+
+
 	template <typename T>
 	TreeNode<T>& TreeNode<T>::operator=(const TreeNode& other)
 	{
-		mParent = nullptr;
-		mData = other.mData;
+		if (this != &other) {
+			mParent = nullptr;
+			mData = other.mData;
+
+			clearDescendants();
+			copyDescendants(other);
+
+			if (other.mSibling) {
+				mSibling = NodePtr(new TreeNode(*other.mSibling));
+				mSibling->mPrevSibling = this;
+			}
+		}
+
+		return *this;
+	}
+
 
-		if (other.mChild) {
-			mChild = std::make_unique<TreeNode>(*other.mChild);
+	template <typename T>
+	TreeNode<T>& TreeNode<T>::operator=(TreeNode&& other)
+		noexcept(std::is_nothrow_move_assignable_v<T>)
+	{
+		if (this != &other) {
+			clearDescendants();
+
+			mParent = other.mParent;
+			mChild = std::move(other.mChild);
+			mLastChild = other.mLastChild;
+			mSibling = std::move(other.mSibling);
+			mPrevSibling = other.mPrevSibling;
+			mResource = other.mResource;
+			mData = std::move(other.mData);
+			other.mLastChild = nullptr;
 
 			TreeNode* child = mChild.get();
 			while (child) {
 				child->mParent = this;
 				child = child->mSibling.get();
 			}
-		}
 
-		if (other.mSibling) {
-			mSibling = std::make_unique<TreeNode>(*other.mSibling);
+			if (mSibling) {
+				mSibling->mPrevSibling = this;
+			}
 		}
 
 		return *this;
@@ -68,13 +130,37 @@ namespace stdext {
 	typename TreeNode<T>::size_type TreeNode<T>::size() const
 	{
 		size_type count = 0;
-		for (auto it = begin<t>(); it != end<t>(); ++it) {
+		for (auto it = cbegin<Traversal::DFSPreOrder>(); it != cend<Traversal::DFSPreOrder>(); ++it) {
 			++count;
 		}
 		return count;
 	}
 
 
+	template <typename T>
+	MemoryStats TreeNode<T>::getMemoryStats() const
+	{
+		// The iterators only visit the descendants, and the sibling of the
+		// current TreeNode isn't part of the tree
+		auto isAllocated = [](const NodePtr& node) {
+			return node && !node->mAllocResource;
+		};
+
+		MemoryStats stats;
+		stats.numElements = 1;
+		stats.numAllocations = isAllocated(mChild)? 1 : 0;
+		for (auto it = cbegin<Traversal::DFSPreOrder>(); it != cend<Traversal::DFSPreOrder>(); ++it) {
+			++stats.numElements;
+			stats.numAllocations += isAllocated(it->mChild)? 1 : 0;
+			stats.numAllocations += isAllocated(it->mSibling)? 1 : 0;
+		}
+
+		stats.reservedBytes = stats.numElements * sizeof(TreeNode);
+		stats.liveBytes = stats.reservedBytes;
+		return stats;
+	}
+
+
 	template <typename T>
 	template <Traversal t>
 	TreeNode<T>::iterator<t> TreeNode<T>::find(const T& data)
@@ -116,57 +202,67 @@ namespace stdext {
 	template <Traversal t>
 	TreeNode<T>::const_iterator<t> TreeNode<T>::find(const TreeNode& node) const
 	{
-		auto it = cbegin<t>();
-
-		while (it != cend<t>()) {
-			if (&(*it) == &node) {
-				break;
-			}
-			else {
-				++it;
-			}
+		const TreeNode* ancestor = node.mParent;
+		while (ancestor && (ancestor != this)) {
+			ancestor = ancestor->mParent;
 		}
 
-		return it;
+		return ancestor? getIterator<t>(&node) : cend<t>();
 	}
 
 
 	template <typename T>
 	template <Traversal t>
 	TreeNode<T>::iterator<t> TreeNode<T>::insert(
-		const_iterator<t> parentIt, std::unique_ptr<TreeNode> descendant
+		const_iterator<t> parentIt, NodePtr descendant
 	) {
 		auto parentNode = this;
 		if (parentIt != cend<t>()) {
 			parentNode = const_cast<TreeNode*>( &(*parentIt) );
 		}
 
-		TreeNode& descendantRef = *descendant;
+		TreeNode& descendantRef = parentNode->insertChild(std::move(descendant));
+		return getIterator<t>(&descendantRef);
+	}
+
 
-		descendant->mParent = parentNode;
-		if (parentNode->mChild) {
-			TreeNode* lastChild = parentNode->mChild.get();
-			while (lastChild->mSibling) {
-				lastChild = lastChild->mSibling.get();
-			}
+	template <typename T>
+	template <Traversal t, typename... Args>
+	TreeNode<T>::iterator<t> TreeNode<T>::emplace(
+		const_iterator<t> parentIt, Args&&... args
+	) {
+		NodePtr descendant = createNode(std::forward<Args>(args)...);
+		return insert(parentIt, std::move(descendant));
+	}
 
-			lastChild->mSibling = std::move(descendant);
+
+	template <typename T>
+	TreeNode<T>& TreeNode<T>::insertChild(NodePtr child)
+	{
+		TreeNode& childRef = *child;
+
+		child->mParent = this;
+		child->mPrevSibling = mLastChild;
+		if (mLastChild) {
+			mLastChild->mSibling = std::move(child);
 		}
 		else {
-			parentNode->mChild = std::move(descendant);
+			mChild = std::move(child);
 		}
+		mLastChild = &childRef;
 
-		return find(descendantRef);
+		return childRef;
 	}
 
 
 	template <typename T>
-	template <Traversal t, typename... Args>
-	TreeNode<T>::iterator<t> TreeNode<T>::emplace(
-		const_iterator<t> parentIt, Args&&... args
-	) {
-		auto descendant = std::make_unique<TreeNode>(std::forward<Args>(args)...);
-		return insert(parentIt, std::move(descendant));
+	void TreeNode<T>::releaseDescendants()
+	{
+		static_assert(std::is_trivially_destructible_v<T>,
+			"The TreeNodes can't be discarded without calling the destructor of T");
+
+		mChild.release();
+		mLastChild = nullptr;
 	}
 
 
@@ -176,7 +272,7 @@ namespace stdext {
 	{
 		TreeNode* currentNode = &(*it);
 		if (eraseDescendants) {
-			mChild = nullptr;
+			currentNode->clearDescendants();
 		}
 		else {
 			moveChildNodesUp(currentNode);
@@ -197,7 +293,7 @@ namespace stdext {
 			moveChildNodesUp(currentNode);
 		}
 
-		std::unique_ptr<TreeNode> nodeUPtr = removeNode(currentNode);
+		NodePtr nodeUPtr = removeNode(currentNode);
 		return insert(parentIt, std::move(nodeUPtr));
 	}
 
@@ -205,62 +301,134 @@ namespace stdext {
 	template <typename T>
 	void TreeNode<T>::moveChildNodesUp(TreeNode* node)
 	{
-		TreeNode* lastChild = nullptr;
+		if (!node->mChild) {
+			return;
+		}
+
 		TreeNode* currentChild = node->mChild.get();
 		while (currentChild) {
 			currentChild->mParent = node->mParent;
-			lastChild = currentChild;
 			currentChild = currentChild->mSibling.get();
 		}
 
-		if (lastChild) {
-			lastChild->mSibling = std::move(node->mSibling);
-			node->mSibling = std::move(node->mChild);
+		TreeNode* lastChild = node->mLastChild;
+		if (node->mParent->mLastChild == node) {
+			node->mParent->mLastChild = lastChild;
+		}
+
+		lastChild->mSibling = std::move(node->mSibling);
+		if (lastChild->mSibling) {
+			lastChild->mSibling->mPrevSibling = lastChild;
 		}
+
+		node->mChild->mPrevSibling = node;
+		node->mSibling = std::move(node->mChild);
+		node->mLastChild = nullptr;
 	}
 
 
 	template <typename T>
-	std::unique_ptr<TreeNode<T>> TreeNode<T>::removeNode(TreeNode* node)
+	typename TreeNode<T>::NodePtr TreeNode<T>::removeNode(TreeNode* node)
 	{
-		std::unique_ptr<TreeNode<T>> ret;
-
-		if (node->mParent->mChild.get() == node) {
-			ret = std::move(node->mParent->mChild);
-			node->mParent->mChild = std::move(ret->mSibling);
+		TreeNode* parent = node->mParent;
+		TreeNode* prevSibling = node->mPrevSibling;
+		NodePtr& owner = prevSibling? prevSibling->mSibling : parent->mChild;
+
+		NodePtr ret = std::move(owner);
+		owner = std::move(ret->mSibling);
+		if (owner) {
+			owner->mPrevSibling = prevSibling;
 		}
 		else {
-			TreeNode* parentChild = node->mParent->mChild.get();
-			while (parentChild) {
-				if (parentChild->mSibling.get() == node) {
-					ret = std::move(parentChild->mSibling);
-					parentChild->mSibling = std::move(ret->mSibling);
-					break;
-				}
-				parentChild = parentChild->mSibling.get();
-			}
+			parent->mLastChild = prevSibling;
 		}
 
 		ret->mParent = nullptr;
+		ret->mPrevSibling = nullptr;
 		return ret;
 	}
 
 
+	template <typename T>
+	void TreeNode<T>::copyDescendants(const TreeNode& other)
+	{
+		const TreeNode* otherChild = other.mChild.get();
+		while (otherChild) {
+			TreeNode& child = insertChild(NodePtr(new TreeNode(otherChild->mData)));
+			child.copyDescendants(*otherChild);
+			otherChild = otherChild->mSibling.get();
+		}
+	}
+
+
+	template <typename T>
+	void TreeNode<T>::clearDescendants()
+	{
+		// The descendants are destroyed one by one, since destroying them
+		// recursively could overflow the stack with wide or deep trees
+		while (mChild) {
+			NodePtr child = std::move(mChild);
+			mChild = std::move(child->mSibling);
+			if (child->mChild) {
+				child->mLastChild->mSibling = std::move(mChild);
+				mChild = std::move(child->mChild);
+			}
+		}
+		mLastChild = nullptr;
+	}
+
+
+	template <typename T>
+	template <typename... Args>
+	typename TreeNode<T>::NodePtr TreeNode<T>::createNode(Args&&... args)
+	{
+		TreeNode* node = nullptr;
+		if (mResource) {
+			void* memory = mResource->allocate(sizeof(TreeNode), alignof(TreeNode));
+			node = new (memory) TreeNode(std::forward<Args>(args)...);
+		}
+		else {
+			node = new TreeNode(std::forward<Args>(args)...);
+		}
+
+		// The descendants of the new TreeNode use the same memory resource
+		node->mResource = mResource;
+		node->mAllocResource = mResource;
+		return NodePtr(node);
+	}
+
+
+	template <typename T>
+	template <Traversal t>
+	TreeNode<T>::const_iterator<t> TreeNode<T>::getIterator(const TreeNode* node) const
+	{
+		size_type depth = 0;
+		if constexpr (t == Traversal::BFS) {
+			for (const TreeNode* ancestor = node; ancestor != this; ancestor = ancestor->mParent) {
+				++depth;
+			}
+		}
+
+		return const_iterator<t>(node, this, depth);
+	}
+
+
 	template <typename T>
 	template <bool isConst, Traversal t>
-	TreeNode<T>::TNIterator<isConst, t>::TNIterator(TreeNodeType* treeNode)
+	TreeNode<T>::TNIterator<isConst, t>::TNIterator(TreeNodeType* treeNode, BFSBuffer* buffer) :
+		mRoot(treeNode), mBuffer(buffer)
 	{
+		if (mBuffer) {
+			mBuffer->clear();
+		}
+
 		if (treeNode) {
+			mNode = treeNode->mChild.get();
+			mDepth = 1;
+
 			if constexpr (t == Traversal::DFSPostOrder) {
-				treeNode = treeNode->mChild.get();
-				while (treeNode) {
-					mTreeNodeDeque.push_back(treeNode);
-					treeNode = treeNode->mChild.get();
-				}
-			}
-			else {
-				if (treeNode->mChild) {
-					mTreeNodeDeque = { treeNode->mChild.get() };
+				while (mNode && mNode->mChild) {
+					mNode = mNode->mChild.get();
 				}
 			}
 		}
@@ -269,22 +437,45 @@ namespace stdext {
 
 	template <typename T>
 	template <bool isConst, Traversal t>
-	TreeNode<T>::TNIterator<isConst, t>::operator
-		TreeNode<T>::TNIterator<!isConst, t>() const
+	TreeNode<T>::TNIterator<isConst, t>::TNIterator(const TNIterator& other) :
+		mNode(other.mNode), mRoot(other.mRoot), mDepth(other.mDepth),
+		mRebuildBuffer(other.mRebuildBuffer)
 	{
-		TNIterator<!isConst, t> ret(nullptr);
+		copyPendingNodes(other.getBuffer(), other.mBufferHead);
+	}
 
-		if constexpr (isConst) {
-			for (const TreeNode* node : mTreeNodeDeque) {
-				ret.mTreeNodeDeque.push_back(const_cast<TreeNode*>(node));
-			}
-		}
-		else {
-			for (TreeNode* node : mTreeNodeDeque) {
-				ret.mTreeNodeDeque.push_back(node);
-			}
+
+	template <typename T>
+	template <bool isConst, Traversal t>
+	TreeNode<T>::TNIterator<isConst, t>&
+		TreeNode<T>::TNIterator<isConst, t>::operator=(const TNIterator& other)
+	{
+		if (this != &other) {
+			mNode = other.mNode;
+			mRoot = other.mRoot;
+			mDepth = other.mDepth;
+			mBuffer = nullptr;
+			mRebuildBuffer = other.mRebuildBuffer;
+			copyPendingNodes(other.getBuffer(), other.mBufferHead);
 		}
 
+		return *this;
+	}
+
+
+	template <typename T>
+	template <bool isConst, Traversal t>
+	TreeNode<T>::TNIterator<isConst, t>::operator
+		TreeNode<T>::TNIterator<!isConst, t>() const
+	{
+		using OtherTreeNodeType = typename TNIterator<!isConst, t>::TreeNodeType;
+
+		TNIterator<!isConst, t> ret;
+		ret.mNode = const_cast<OtherTreeNodeType*>(mNode);
+		ret.mRoot = const_cast<OtherTreeNodeType*>(mRoot);
+		ret.mDepth = mDepth;
+		ret.mRebuildBuffer = mRebuildBuffer;
+		ret.copyPendingNodes(getBuffer(), mBufferHead);
 		return ret;
 	}
 
@@ -326,22 +517,89 @@ namespace stdext {
 	template <bool isConst, Traversal t>
 	void TreeNode<T>::TNIterator<isConst, t>::nextBFS()
 	{
-		if (!mTreeNodeDeque.empty()) {
-			TreeNodeType* node = mTreeNodeDeque.back();
-			if (node->mSibling) {
-				mTreeNodeDeque.push_back(node->mSibling.get());
-			}
-			else {
-				while (!mTreeNodeDeque.empty()) {
-					node = mTreeNodeDeque.front();
-					mTreeNodeDeque.pop_front();
-					if (node->mChild) {
-						mTreeNodeDeque.push_back(node->mChild.get());
-						break;
+		if (!mNode) {
+			return;
+		}
+
+		if (mRebuildBuffer) {
+			rebuildBuffer();
+		}
+
+		// The queue has the visited TreeNodes whose children haven't been
+		// visited yet
+		BFSBuffer& buffer = getBuffer();
+		if (mNode->mChild) {
+			buffer.push_back(mNode);
+		}
+
+		if (mNode->mSibling) {
+			mNode = mNode->mSibling.get();
+		}
+		else if (mBufferHead < buffer.size()) {
+			mNode = const_cast<TreeNodeType*>( buffer[mBufferHead++]->mChild.get() );
+		}
+		else {
+			mNode = nullptr;
+		}
+
+		// The visited part of the queue is discarded once it's at least as
+		// large as the pending one, so its size is bounded by the width of
+		// the tree
+		if (mBufferHead == buffer.size()) {
+			buffer.clear();
+			mBufferHead = 0;
+		}
+		else if ((mBufferHead >= 32) && (2 * mBufferHead >= buffer.size())) {
+			buffer.erase(buffer.begin(), buffer.begin() + mBufferHead);
+			mBufferHead = 0;
+		}
+	}
+
+
+	template <typename T>
+	template <bool isConst, Traversal t>
+	void TreeNode<T>::TNIterator<isConst, t>::copyPendingNodes(
+		const BFSBuffer& buffer, size_type bufferHead
+	) {
+		mBuffer = nullptr;
+		mBufferHead = 0;
+		mOwnBuffer.assign(buffer.begin() + bufferHead, buffer.end());
+	}
+
+
+	template <typename T>
+	template <bool isConst, Traversal t>
+	void TreeNode<T>::TNIterator<isConst, t>::rebuildBuffer()
+	{
+		BFSBuffer& buffer = getBuffer();
+		buffer.clear();
+		mBufferHead = 0;
+		mRebuildBuffer = false;
+
+		// The TreeNodes of the previous level located after the parent of
+		// the current one
+		if (mDepth > 1) {
+			bool afterParent = false;
+			size_type depth = 0;
+			TreeNodeType* node = mRoot;
+			while ((node = nextLimitedPreOrder(node, depth, mDepth - 1)) != nullptr) {
+				if (depth == mDepth - 1) {
+					if (afterParent && node->mChild) {
+						buffer.push_back(node);
 					}
+					afterParent = afterParent || (node == mNode->mParent);
 				}
 			}
 		}
+
+		// The TreeNodes of the current level located before the current one
+		size_type depth = 0;
+		TreeNodeType* node = mRoot;
+		while (((node = nextLimitedPreOrder(node, depth, mDepth)) != nullptr) && (node != mNode)) {
+			if ((depth == mDepth) && node->mChild) {
+				buffer.push_back(node);
+			}
+		}
 	}
 
 
@@ -349,20 +607,15 @@ namespace stdext {
 	template <bool isConst, Traversal t>
 	void TreeNode<T>::TNIterator<isConst, t>::nextDFSPreOrder()
 	{
-		if (!mTreeNodeDeque.empty()) {
-			TreeNodeType* node = mTreeNodeDeque.back();
-			if (node->mChild) {
-				mTreeNodeDeque.push_back(node->mChild.get());
+		if (mNode) {
+			if (mNode->mChild) {
+				mNode = mNode->mChild.get();
 			}
 			else {
-				while (!mTreeNodeDeque.empty()) {
-					node = mTreeNodeDeque.back();
-					mTreeNodeDeque.pop_back();
-					if (node->mSibling) {
-						mTreeNodeDeque.push_back(node->mSibling.get());
-						break;
-					}
+				while ((mNode != mRoot) && !mNode->mSibling) {
+					mNode = mNode->mParent;
 				}
+				mNode = (mNode != mRoot)? mNode->mSibling.get() : nullptr;
 			}
 		}
 	}
@@ -372,14 +625,17 @@ namespace stdext {
 	template <bool isConst, Traversal t>
 	void TreeNode<T>::TNIterator<isConst, t>::nextDFSPostOrder()
 	{
-		if (!mTreeNodeDeque.empty()) {
-			TreeNodeType* node = mTreeNodeDeque.back();
-			mTreeNodeDeque.pop_back();
-			if (node->mSibling) {
-				node = node->mSibling.get();
-				while (node) {
-					mTreeNodeDeque.push_back(node);
-					node = node->mChild.get();
+		if (mNode) {
+			if (mNode->mSibling) {
+				mNode = mNode->mSibling.get();
+				while (mNode->mChild) {
+					mNode = mNode->mChild.get();
+				}
+			}
+			else {
+				mNode = mNode->mParent;
+				if (mNode == mRoot) {
+					mNode = nullptr;
 				}
 			}
 		}
@@ -390,13 +646,33 @@ namespace stdext {
 	template <bool isConst, Traversal t>
 	void TreeNode<T>::TNIterator<isConst, t>::nextChildren()
 	{
-		if (!mTreeNodeDeque.empty()) {
-			TreeNodeType* node = mTreeNodeDeque.back();
-			mTreeNodeDeque.pop_back();
+		if (mNode) {
+			mNode = mNode->mSibling.get();
+		}
+	}
+
+
+	template <typename T>
+	template <bool isConst, Traversal t>
+	typename TreeNode<T>::template TNIterator<isConst, t>::TreeNodeType*
+		TreeNode<T>::TNIterator<isConst, t>::nextLimitedPreOrder(
+			TreeNodeType* node, size_type& depth, size_type maxDepth
+		) const
+	{
+		if ((depth < maxDepth) && node->mChild) {
+			++depth;
+			return node->mChild.get();
+		}
+
+		while (node != mRoot) {
 			if (node->mSibling) {
-				mTreeNodeDeque.push_back(node->mSibling.get());
+				return node->mSibling.get();
 			}
+			node = node->mParent;
+			--depth;
 		}
+
+		return nullptr;
 	}
 
 }
@@ -0,0 +1,155 @@
+#ifdef _WIN32
+	#define WIN32_LEAN_AND_MEAN
+	#define NOMINMAX
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <unistd.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+#endif
+#include "stdext/MappedFile.h"
+
+namespace stdext {
+
+	MappedFile::MappedFile() :
+		mData(nullptr), mSize(0), mMode(Mode::ReadOnly)
+#ifdef _WIN32
+		, mFileHandle(nullptr), mMappingHandle(nullptr)
+#endif
+	{}
+
+
+	MappedFile::MappedFile(MappedFile&& other) :
+		mData(other.mData), mSize(other.mSize), mMode(other.mMode)
+#ifdef _WIN32
+		, mFileHandle(other.mFileHandle), mMappingHandle(other.mMappingHandle)
+#endif
+	{
+		other.mData = nullptr;
+		other.mSize = 0;
+#ifdef _WIN32
+		other.mFileHandle = nullptr;
+		other.mMappingHandle = nullptr;
+#endif
+	}
+
+
+	MappedFile::~MappedFile()
+	{
+		close();
+	}
+
+
+	MappedFile& MappedFile::operator=(MappedFile&& other)
+	{
+		if (this != &other) {
+			close();
+
+			mData = other.mData;
+			mSize = other.mSize;
+			mMode = other.mMode;
+			other.mData = nullptr;
+			other.mSize = 0;
+#ifdef _WIN32
+			mFileHandle = other.mFileHandle;
+			mMappingHandle = other.mMappingHandle;
+			other.mFileHandle = nullptr;
+			other.mMappingHandle = nullptr;
+#endif
+		}
+
+		return *this;
+	}
+
+
+	bool MappedFile::open(const char* path, Mode mode)
+	{
+		close();
+
+#ifdef _WIN32
+		HANDLE file = CreateFileA(
+			path, GENERIC_READ, FILE_SHARE_READ, nullptr,
+			OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr
+		);
+		if (file == INVALID_HANDLE_VALUE) {
+			return false;
+		}
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(file, &fileSize) || (fileSize.QuadPart == 0)) {
+			CloseHandle(file);
+			return false;
+		}
+
+		HANDLE mapping = CreateFileMappingA(
+			file, nullptr, (mode == Mode::CopyOnWrite)? PAGE_WRITECOPY : PAGE_READONLY,
+			0, 0, nullptr
+		);
+		if (!mapping) {
+			CloseHandle(file);
+			return false;
+		}
+
+		void* data = MapViewOfFile(
+			mapping, (mode == Mode::CopyOnWrite)? FILE_MAP_COPY : FILE_MAP_READ,
+			0, 0, 0
+		);
+		if (!data) {
+			CloseHandle(mapping);
+			CloseHandle(file);
+			return false;
+		}
+
+		mFileHandle = file;
+		mMappingHandle = mapping;
+		mSize = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+		int fd = ::open(path, O_RDONLY);
+		if (fd < 0) {
+			return false;
+		}
+
+		struct stat fileStat;
+		if ((fstat(fd, &fileStat) != 0) || (fileStat.st_size <= 0)) {
+			::close(fd);
+			return false;
+		}
+
+		// A private mapping gives copy on write pages, the file is opened as
+		// read only so the changes can't be written back
+		int protection = (mode == Mode::CopyOnWrite)? (PROT_READ | PROT_WRITE) : PROT_READ;
+		std::size_t size = static_cast<std::size_t>(fileStat.st_size);
+		void* data = mmap(nullptr, size, protection, MAP_PRIVATE, fd, 0);
+		::close(fd);
+		if (data == MAP_FAILED) {
+			return false;
+		}
+
+		mSize = size;
+#endif
+
+		mData = static_cast<std::byte*>(data);
+		mMode = mode;
+		return true;
+	}
+
+
+	void MappedFile::close()
+	{
+		if (mData) {
+#ifdef _WIN32
+			UnmapViewOfFile(mData);
+			CloseHandle(mMappingHandle);
+			CloseHandle(mFileHandle);
+			mFileHandle = nullptr;
+			mMappingHandle = nullptr;
+#else
+			munmap(mData, mSize);
+#endif
+			mData = nullptr;
+			mSize = 0;
+		}
+	}
+
+}
@@ -0,0 +1,112 @@
+#include "stdext/MemoryRegistry.h"
+
+namespace stdext {
+
+	MemoryRegistry::Registration::Registration(Registration&& other) :
+		mRegistry(other.mRegistry), mId(other.mId)
+	{
+		other.mRegistry = nullptr;
+	}
+
+
+	MemoryRegistry::Registration& MemoryRegistry::Registration::operator=(Registration&& other)
+	{
+		if (this != &other) {
+			reset();
+			mRegistry = other.mRegistry;
+			mId = other.mId;
+			other.mRegistry = nullptr;
+		}
+
+		return *this;
+	}
+
+
+	void MemoryRegistry::Registration::reset()
+	{
+		if (mRegistry) {
+			mRegistry->remove(mId);
+			mRegistry = nullptr;
+		}
+	}
+
+
+	void MemoryRegistry::Registration::update()
+	{
+		if (mRegistry) {
+			mRegistry->update(mId);
+		}
+	}
+
+
+	MemoryRegistry& MemoryRegistry::getInstance()
+	{
+		static MemoryRegistry instance;
+		return instance;
+	}
+
+
+	MemoryRegistry::Registration MemoryRegistry::addStatsFunction(
+		std::string typeName, std::function<MemoryStats()> getStats
+	) {
+		MemoryStats stats = getStats();
+
+		std::scoped_lock lock(mMutex);
+		std::size_t id = mNextId++;
+		mEntries.emplace(id, Entry{ std::move(typeName), std::move(getStats), stats });
+		return Registration(this, id);
+	}
+
+
+	std::map<std::string, MemoryStats> MemoryRegistry::getStatsByType() const
+	{
+		std::scoped_lock lock(mMutex);
+		std::map<std::string, MemoryStats> ret;
+		for (const auto& [id, entry] : mEntries) {
+			ret[entry.typeName] += entry.stats;
+		}
+
+		return ret;
+	}
+
+
+	MemoryStats MemoryRegistry::getTotalStats() const
+	{
+		std::scoped_lock lock(mMutex);
+		MemoryStats ret;
+		for (const auto& [id, entry] : mEntries) {
+			ret += entry.stats;
+		}
+
+		return ret;
+	}
+
+
+	void MemoryRegistry::update(std::size_t id)
+	{
+		// The Entry can only be removed by its Registration, so it can be
+		// used without the lock while its MemoryStats are retrieved
+		const Entry* entry = nullptr;
+		{
+			std::scoped_lock lock(mMutex);
+			auto it = mEntries.find(id);
+			if (it == mEntries.end()) {
+				return;
+			}
+			entry = &it->second;
+		}
+
+		MemoryStats stats = entry->getStats();
+
+		std::scoped_lock lock(mMutex);
+		mEntries.find(id)->second.stats = stats;
+	}
+
+
+	void MemoryRegistry::remove(std::size_t id)
+	{
+		std::scoped_lock lock(mMutex);
+		mEntries.erase(id);
+	}
+
+}
@@ -0,0 +1,20 @@
+#include "stdext/ReleaseVectorSnapshot.h"
+
+namespace stdext {
+
+	bool validateReleasedIndices(
+		const std::uint64_t* releasedIndices, std::uint64_t numReleasedIndices,
+		std::uint64_t endIndex
+	) {
+		for (std::uint64_t i = 0; i < numReleasedIndices; ++i) {
+			if ((releasedIndices[i] >= endIndex)
+				|| ((i > 0) && (releasedIndices[i] <= releasedIndices[i - 1]))
+			) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+}
@@ -0,0 +1,256 @@
+#ifndef STDEXT_SIMD_KERNELS_H
+#define STDEXT_SIMD_KERNELS_H
+
+#include "stdext/SIMDUtils.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+	#define STDEXT_SIMD_X86
+#endif
+
+namespace stdext {
+
+	/** Struct SSE2Kernels, holds the kernels implemented with SSE2 */
+	struct SSE2Kernels
+	{
+		static std::size_t find(const std::int32_t* data, std::size_t size, std::int32_t value);
+		static std::size_t find(const float* data, std::size_t size, float value);
+		static std::size_t find(const double* data, std::size_t size, double value);
+		static std::size_t find(const std::int64_t* data, std::size_t size, std::int64_t value);
+		static std::size_t count(const std::int32_t* data, std::size_t size, std::int32_t value);
+		static std::size_t count(const float* data, std::size_t size, float value);
+		static std::size_t count(const double* data, std::size_t size, double value);
+		static std::size_t count(const std::int64_t* data, std::size_t size, std::int64_t value);
+		static std::int32_t min(const std::int32_t* data, std::size_t size);
+		static float min(const float* data, std::size_t size);
+		static double min(const double* data, std::size_t size);
+		static std::int32_t max(const std::int32_t* data, std::size_t size);
+		static float max(const float* data, std::size_t size);
+		static double max(const double* data, std::size_t size);
+		static std::int64_t sum(const std::int32_t* data, std::size_t size);
+		static float sum(const float* data, std::size_t size);
+		static double sum(const double* data, std::size_t size);
+	};
+
+
+	/** Struct AVX2Kernels, holds the kernels implemented with AVX2. Its
+	 * source file is the only one compiled with AVX2 enabled */
+	struct AVX2Kernels
+	{
+		static std::size_t find(const std::int32_t* data, std::size_t size, std::int32_t value);
+		static std::size_t find(const float* data, std::size_t size, float value);
+		static std::size_t find(const double* data, std::size_t size, double value);
+		static std::size_t find(const std::int64_t* data, std::size_t size, std::int64_t value);
+		static std::size_t count(const std::int32_t* data, std::size_t size, std::int32_t value);
+		static std::size_t count(const float* data, std::size_t size, float value);
+		static std::size_t count(const double* data, std::size_t size, double value);
+		static std::size_t count(const std::int64_t* data, std::size_t size, std::int64_t value);
+		static std::int32_t min(const std::int32_t* data, std::size_t size);
+		static float min(const float* data, std::size_t size);
+		static double min(const double* data, std::size_t size);
+		static std::int32_t max(const std::int32_t* data, std::size_t size);
+		static float max(const float* data, std::size_t size);
+		static double max(const double* data, std::size_t size);
+		static std::int64_t sum(const std::int32_t* data, std::size_t size);
+		static float sum(const float* data, std::size_t size);
+		static double sum(const double* data, std::size_t size);
+	};
+
+
+	/* The generic kernels are instantiated with different instruction sets
+	 * in each source file, so they have internal linkage. Otherwise the
+	 * linker could merge the AVX2 instantiations with the other ones */
+	namespace {
+
+		/** @return	the number of bits set in the given mask */
+		inline int countBits(unsigned int mask)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return __builtin_popcount(mask);
+#else
+			int ret = 0;
+			for (; mask != 0; mask &= mask - 1) {
+				++ret;
+			}
+			return ret;
+#endif
+		}
+
+
+		/** @return	the position of the lowest bit set in the given mask,
+		 *			which can't be 0 */
+		inline int lowestBit(unsigned int mask)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return __builtin_ctz(mask);
+#else
+			int ret = 0;
+			for (; (mask & 1) == 0; mask >>= 1) {
+				++ret;
+			}
+			return ret;
+#endif
+		}
+
+
+		/* The kernels receive a register type R with the following members:
+		 *	T		the type of the elements
+		 *	V		the type of the register
+		 *	Acc		the type of the register used for adding the elements
+		 *	kWidth	the number of elements in V
+		 *	load, set1, store, eq (mask with a bit per element), min, max,
+		 *	zero, add (V to Acc) and reduce (Acc to SumType<T>)
+		 * The registers used only by the find and count kernels just need
+		 * T, V, kWidth, load, set1 and eq */
+
+		template <typename T>
+		std::size_t scalarFind(const T* data, std::size_t size, T value)
+		{
+			std::size_t i = 0;
+			for (; (i < size) && !(data[i] == value); ++i);
+			return i;
+		}
+
+
+		template <typename T>
+		std::size_t scalarCount(const T* data, std::size_t size, T value)
+		{
+			std::size_t ret = 0;
+			for (std::size_t i = 0; i < size; ++i) {
+				ret += (data[i] == value)? 1 : 0;
+			}
+			return ret;
+		}
+
+
+		template <typename T>
+		T scalarMin(const T* data, std::size_t size)
+		{
+			T ret = data[0];
+			for (std::size_t i = 1; i < size; ++i) {
+				ret = (data[i] < ret)? data[i] : ret;
+			}
+			return ret;
+		}
+
+
+		template <typename T>
+		T scalarMax(const T* data, std::size_t size)
+		{
+			T ret = data[0];
+			for (std::size_t i = 1; i < size; ++i) {
+				ret = (ret < data[i])? data[i] : ret;
+			}
+			return ret;
+		}
+
+
+		template <typename T>
+		SumType<T> scalarSum(const T* data, std::size_t size)
+		{
+			SumType<T> ret = 0;
+			for (std::size_t i = 0; i < size; ++i) {
+				ret += data[i];
+			}
+			return ret;
+		}
+
+
+		template <typename R>
+		std::size_t findKernel(const typename R::T* data, std::size_t size, typename R::T value)
+		{
+			typename R::V vValue = R::set1(value);
+
+			std::size_t i = 0;
+			for (; i + R::kWidth <= size; i += R::kWidth) {
+				unsigned int mask = R::eq(R::load(data + i), vValue);
+				if (mask != 0) {
+					return i + lowestBit(mask);
+				}
+			}
+
+			return i + scalarFind(data + i, size - i, value);
+		}
+
+
+		template <typename R>
+		std::size_t countKernel(const typename R::T* data, std::size_t size, typename R::T value)
+		{
+			typename R::V vValue = R::set1(value);
+
+			std::size_t ret = 0, i = 0;
+			for (; i + R::kWidth <= size; i += R::kWidth) {
+				ret += countBits(R::eq(R::load(data + i), vValue));
+			}
+
+			return ret + scalarCount(data + i, size - i, value);
+		}
+
+
+		template <typename R>
+		typename R::T minKernel(const typename R::T* data, std::size_t size)
+		{
+			using T = typename R::T;
+			if (size < R::kWidth) {
+				return scalarMin(data, size);
+			}
+
+			typename R::V vMin = R::load(data);
+			std::size_t i = R::kWidth;
+			for (; i + R::kWidth <= size; i += R::kWidth) {
+				vMin = R::min(vMin, R::load(data + i));
+			}
+
+			T lanes[R::kWidth];
+			R::store(lanes, vMin);
+			T ret = scalarMin(lanes, R::kWidth);
+			if (i < size) {
+				T tailMin = scalarMin(data + i, size - i);
+				ret = (tailMin < ret)? tailMin : ret;
+			}
+			return ret;
+		}
+
+
+		template <typename R>
+		typename R::T maxKernel(const typename R::T* data, std::size_t size)
+		{
+			using T = typename R::T;
+			if (size < R::kWidth) {
+				return scalarMax(data, size);
+			}
+
+			typename R::V vMax = R::load(data);
+			std::size_t i = R::kWidth;
+			for (; i + R::kWidth <= size; i += R::kWidth) {
+				vMax = R::max(vMax, R::load(data + i));
+			}
+
+			T lanes[R::kWidth];
+			R::store(lanes, vMax);
+			T ret = scalarMax(lanes, R::kWidth);
+			if (i < size) {
+				T tailMax = scalarMax(data + i, size - i);
+				ret = (ret < tailMax)? tailMax : ret;
+			}
+			return ret;
+		}
+
+
+		template <typename R>
+		SumType<typename R::T> sumKernel(const typename R::T* data, std::size_t size)
+		{
+			typename R::Acc vSum = R::zero();
+
+			std::size_t i = 0;
+			for (; i + R::kWidth <= size; i += R::kWidth) {
+				vSum = R::add(vSum, R::load(data + i));
+			}
+
+			return R::reduce(vSum) + scalarSum(data + i, size - i);
+		}
+
+	}
+
+}
+
+#endif		// STDEXT_SIMD_KERNELS_H
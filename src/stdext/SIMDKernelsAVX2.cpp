@@ -0,0 +1,197 @@
+#include "SIMDKernels.h"
+
+#ifdef STDEXT_SIMD_X86
+
+#ifdef __AVX2__
+	#include <immintrin.h>
+#endif
+
+namespace stdext {
+
+#ifdef __AVX2__
+
+	namespace {
+
+		struct AVX2Int32
+		{
+			using T = std::int32_t;
+			using V = __m256i;
+			using Acc = __m256i;
+			static constexpr std::size_t kWidth = 8;
+
+			static V load(const T* p) { return _mm256_loadu_si256(reinterpret_cast<const V*>(p)); };
+			static V set1(T value) { return _mm256_set1_epi32(value); };
+			static void store(T* p, V v) { _mm256_storeu_si256(reinterpret_cast<V*>(p), v); };
+			static unsigned int eq(V a, V b)
+			{ return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b))); };
+			static V min(V a, V b) { return _mm256_min_epi32(a, b); };
+			static V max(V a, V b) { return _mm256_max_epi32(a, b); };
+			static Acc zero() { return _mm256_setzero_si256(); };
+			static Acc add(Acc acc, V v)
+			{
+				// The elements are sign extended to 64 bits
+				acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+				return _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+			};
+			static std::int64_t reduce(Acc acc)
+			{
+				std::int64_t lanes[4];
+				_mm256_storeu_si256(reinterpret_cast<V*>(lanes), acc);
+				return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+			};
+		};
+
+
+		struct AVX2Float
+		{
+			using T = float;
+			using V = __m256;
+			using Acc = __m256;
+			static constexpr std::size_t kWidth = 8;
+
+			static V load(const T* p) { return _mm256_loadu_ps(p); };
+			static V set1(T value) { return _mm256_set1_ps(value); };
+			static void store(T* p, V v) { _mm256_storeu_ps(p, v); };
+			static unsigned int eq(V a, V b)
+			{ return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)); };
+			static V min(V a, V b) { return _mm256_min_ps(a, b); };
+			static V max(V a, V b) { return _mm256_max_ps(a, b); };
+			static Acc zero() { return _mm256_setzero_ps(); };
+			static Acc add(Acc acc, V v) { return _mm256_add_ps(acc, v); };
+			static float reduce(Acc acc)
+			{
+				float lanes[8];
+				_mm256_storeu_ps(lanes, acc);
+				return ((lanes[0] + lanes[1]) + (lanes[2] + lanes[3]))
+					+ ((lanes[4] + lanes[5]) + (lanes[6] + lanes[7]));
+			};
+		};
+
+
+		struct AVX2Double
+		{
+			using T = double;
+			using V = __m256d;
+			using Acc = __m256d;
+			static constexpr std::size_t kWidth = 4;
+
+			static V load(const T* p) { return _mm256_loadu_pd(p); };
+			static V set1(T value) { return _mm256_set1_pd(value); };
+			static void store(T* p, V v) { _mm256_storeu_pd(p, v); };
+			static unsigned int eq(V a, V b)
+			{ return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ)); };
+			static V min(V a, V b) { return _mm256_min_pd(a, b); };
+			static V max(V a, V b) { return _mm256_max_pd(a, b); };
+			static Acc zero() { return _mm256_setzero_pd(); };
+			static Acc add(Acc acc, V v) { return _mm256_add_pd(acc, v); };
+			static double reduce(Acc acc)
+			{
+				double lanes[4];
+				_mm256_storeu_pd(lanes, acc);
+				return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+			};
+		};
+
+
+		struct AVX2Int64
+		{
+			using T = std::int64_t;
+			using V = __m256i;
+			static constexpr std::size_t kWidth = 4;
+
+			static V load(const T* p) { return _mm256_loadu_si256(reinterpret_cast<const V*>(p)); };
+			static V set1(T value) { return _mm256_set1_epi64x(value); };
+			static unsigned int eq(V a, V b)
+			{ return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(a, b))); };
+		};
+
+	}
+
+
+	std::size_t AVX2Kernels::find(const std::int32_t* data, std::size_t size, std::int32_t value)
+	{ return findKernel<AVX2Int32>(data, size, value); }
+	std::size_t AVX2Kernels::find(const float* data, std::size_t size, float value)
+	{ return findKernel<AVX2Float>(data, size, value); }
+	std::size_t AVX2Kernels::find(const double* data, std::size_t size, double value)
+	{ return findKernel<AVX2Double>(data, size, value); }
+	std::size_t AVX2Kernels::find(const std::int64_t* data, std::size_t size, std::int64_t value)
+	{ return findKernel<AVX2Int64>(data, size, value); }
+
+	std::size_t AVX2Kernels::count(const std::int32_t* data, std::size_t size, std::int32_t value)
+	{ return countKernel<AVX2Int32>(data, size, value); }
+	std::size_t AVX2Kernels::count(const float* data, std::size_t size, float value)
+	{ return countKernel<AVX2Float>(data, size, value); }
+	std::size_t AVX2Kernels::count(const double* data, std::size_t size, double value)
+	{ return countKernel<AVX2Double>(data, size, value); }
+	std::size_t AVX2Kernels::count(const std::int64_t* data, std::size_t size, std::int64_t value)
+	{ return countKernel<AVX2Int64>(data, size, value); }
+
+	std::int32_t AVX2Kernels::min(const std::int32_t* data, std::size_t size)
+	{ return minKernel<AVX2Int32>(data, size); }
+	float AVX2Kernels::min(const float* data, std::size_t size)
+	{ return minKernel<AVX2Float>(data, size); }
+	double AVX2Kernels::min(const double* data, std::size_t size)
+	{ return minKernel<AVX2Double>(data, size); }
+
+	std::int32_t AVX2Kernels::max(const std::int32_t* data, std::size_t size)
+	{ return maxKernel<AVX2Int32>(data, size); }
+	float AVX2Kernels::max(const float* data, std::size_t size)
+	{ return maxKernel<AVX2Float>(data, size); }
+	double AVX2Kernels::max(const double* data, std::size_t size)
+	{ return maxKernel<AVX2Double>(data, size); }
+
+	std::int64_t AVX2Kernels::sum(const std::int32_t* data, std::size_t size)
+	{ return sumKernel<AVX2Int32>(data, size); }
+	float AVX2Kernels::sum(const float* data, std::size_t size)
+	{ return sumKernel<AVX2Float>(data, size); }
+	double AVX2Kernels::sum(const double* data, std::size_t size)
+	{ return sumKernel<AVX2Double>(data, size); }
+
+#else
+
+	// The file was compiled without AVX2 support, so the SSE2 kernels are
+	// used instead
+	std::size_t AVX2Kernels::find(const std::int32_t* data, std::size_t size, std::int32_t value)
+	{ return SSE2Kernels::find(data, size, value); }
+	std::size_t AVX2Kernels::find(const float* data, std::size_t size, float value)
+	{ return SSE2Kernels::find(data, size, value); }
+	std::size_t AVX2Kernels::find(const double* data, std::size_t size, double value)
+	{ return SSE2Kernels::find(data, size, value); }
+	std::size_t AVX2Kernels::find(const std::int64_t* data, std::size_t size, std::int64_t value)
+	{ return SSE2Kernels::find(data, size, value); }
+
+	std::size_t AVX2Kernels::count(const std::int32_t* data, std::size_t size, std::int32_t value)
+	{ return SSE2Kernels::count(data, size, value); }
+	std::size_t AVX2Kernels::count(const float* data, std::size_t size, float value)
+	{ return SSE2Kernels::count(data, size, value); }
+	std::size_t AVX2Kernels::count(const double* data, std::size_t size, double value)
+	{ return SSE2Kernels::count(data, size, value); }
+	std::size_t AVX2Kernels::count(const std::int64_t* data, std::size_t size, std::int64_t value)
+	{ return SSE2Kernels::count(data, size, value); }
+
+	std::int32_t AVX2Kernels::min(const std::int32_t* data, std::size_t size)
+	{ return SSE2Kernels::min(data, size); }
+	float AVX2Kernels::min(const float* data, std::size_t size)
+	{ return SSE2Kernels::min(data, size); }
+	double AVX2Kernels::min(const double* data, std::size_t size)
+	{ return SSE2Kernels::min(data, size); }
+
+	std::int32_t AVX2Kernels::max(const std::int32_t* data, std::size_t size)
+	{ return SSE2Kernels::max(data, size); }
+	float AVX2Kernels::max(const float* data, std::size_t size)
+	{ return SSE2Kernels::max(data, size); }
+	double AVX2Kernels::max(const double* data, std::size_t size)
+	{ return SSE2Kernels::max(data, size); }
+
+	std::int64_t AVX2Kernels::sum(const std::int32_t* data, std::size_t size)
+	{ return SSE2Kernels::sum(data, size); }
+	float AVX2Kernels::sum(const float* data, std::size_t size)
+	{ return SSE2Kernels::sum(data, size); }
+	double AVX2Kernels::sum(const double* data, std::size_t size)
+	{ return SSE2Kernels::sum(data, size); }
+
+#endif		// __AVX2__
+
+}
+
+#endif		// STDEXT_SIMD_X86
@@ -0,0 +1,160 @@
+#include "SIMDKernels.h"
+
+#ifdef STDEXT_SIMD_X86
+
+#include <emmintrin.h>
+
+namespace stdext {
+
+	namespace {
+
+		struct SSE2Int32
+		{
+			using T = std::int32_t;
+			using V = __m128i;
+			using Acc = __m128i;
+			static constexpr std::size_t kWidth = 4;
+
+			static V load(const T* p) { return _mm_loadu_si128(reinterpret_cast<const V*>(p)); };
+			static V set1(T value) { return _mm_set1_epi32(value); };
+			static void store(T* p, V v) { _mm_storeu_si128(reinterpret_cast<V*>(p), v); };
+			static unsigned int eq(V a, V b)
+			{ return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b))); };
+			static V min(V a, V b)
+			{
+				V aGreater = _mm_cmpgt_epi32(a, b);
+				return _mm_or_si128(_mm_and_si128(aGreater, b), _mm_andnot_si128(aGreater, a));
+			};
+			static V max(V a, V b)
+			{
+				V aGreater = _mm_cmpgt_epi32(a, b);
+				return _mm_or_si128(_mm_and_si128(aGreater, a), _mm_andnot_si128(aGreater, b));
+			};
+			static Acc zero() { return _mm_setzero_si128(); };
+			static Acc add(Acc acc, V v)
+			{
+				// The elements are sign extended to 64 bits
+				V sign = _mm_srai_epi32(v, 31);
+				acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(v, sign));
+				return _mm_add_epi64(acc, _mm_unpackhi_epi32(v, sign));
+			};
+			static std::int64_t reduce(Acc acc)
+			{
+				std::int64_t lanes[2];
+				_mm_storeu_si128(reinterpret_cast<V*>(lanes), acc);
+				return lanes[0] + lanes[1];
+			};
+		};
+
+
+		struct SSE2Float
+		{
+			using T = float;
+			using V = __m128;
+			using Acc = __m128;
+			static constexpr std::size_t kWidth = 4;
+
+			static V load(const T* p) { return _mm_loadu_ps(p); };
+			static V set1(T value) { return _mm_set1_ps(value); };
+			static void store(T* p, V v) { _mm_storeu_ps(p, v); };
+			static unsigned int eq(V a, V b) { return _mm_movemask_ps(_mm_cmpeq_ps(a, b)); };
+			static V min(V a, V b) { return _mm_min_ps(a, b); };
+			static V max(V a, V b) { return _mm_max_ps(a, b); };
+			static Acc zero() { return _mm_setzero_ps(); };
+			static Acc add(Acc acc, V v) { return _mm_add_ps(acc, v); };
+			static float reduce(Acc acc)
+			{
+				float lanes[4];
+				_mm_storeu_ps(lanes, acc);
+				return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+			};
+		};
+
+
+		struct SSE2Double
+		{
+			using T = double;
+			using V = __m128d;
+			using Acc = __m128d;
+			static constexpr std::size_t kWidth = 2;
+
+			static V load(const T* p) { return _mm_loadu_pd(p); };
+			static V set1(T value) { return _mm_set1_pd(value); };
+			static void store(T* p, V v) { _mm_storeu_pd(p, v); };
+			static unsigned int eq(V a, V b) { return _mm_movemask_pd(_mm_cmpeq_pd(a, b)); };
+			static V min(V a, V b) { return _mm_min_pd(a, b); };
+			static V max(V a, V b) { return _mm_max_pd(a, b); };
+			static Acc zero() { return _mm_setzero_pd(); };
+			static Acc add(Acc acc, V v) { return _mm_add_pd(acc, v); };
+			static double reduce(Acc acc)
+			{
+				double lanes[2];
+				_mm_storeu_pd(lanes, acc);
+				return lanes[0] + lanes[1];
+			};
+		};
+
+
+		struct SSE2Int64
+		{
+			using T = std::int64_t;
+			using V = __m128i;
+			static constexpr std::size_t kWidth = 2;
+
+			static V load(const T* p) { return _mm_loadu_si128(reinterpret_cast<const V*>(p)); };
+			static V set1(T value) { return _mm_set1_epi64x(value); };
+			static unsigned int eq(V a, V b)
+			{
+				// There is no 64 bits comparison in SSE2, so both halves of
+				// each element are compared and then combined
+				V eq32 = _mm_cmpeq_epi32(a, b);
+				V eq64 = _mm_and_si128(eq32, _mm_shuffle_epi32(eq32, _MM_SHUFFLE(2, 3, 0, 1)));
+				return _mm_movemask_pd(_mm_castsi128_pd(eq64));
+			};
+		};
+
+	}
+
+
+	std::size_t SSE2Kernels::find(const std::int32_t* data, std::size_t size, std::int32_t value)
+	{ return findKernel<SSE2Int32>(data, size, value); }
+	std::size_t SSE2Kernels::find(const float* data, std::size_t size, float value)
+	{ return findKernel<SSE2Float>(data, size, value); }
+	std::size_t SSE2Kernels::find(const double* data, std::size_t size, double value)
+	{ return findKernel<SSE2Double>(data, size, value); }
+	std::size_t SSE2Kernels::find(const std::int64_t* data, std::size_t size, std::int64_t value)
+	{ return findKernel<SSE2Int64>(data, size, value); }
+
+	std::size_t SSE2Kernels::count(const std::int32_t* data, std::size_t size, std::int32_t value)
+	{ return countKernel<SSE2Int32>(data, size, value); }
+	std::size_t SSE2Kernels::count(const float* data, std::size_t size, float value)
+	{ return countKernel<SSE2Float>(data, size, value); }
+	std::size_t SSE2Kernels::count(const double* data, std::size_t size, double value)
+	{ return countKernel<SSE2Double>(data, size, value); }
+	std::size_t SSE2Kernels::count(const std::int64_t* data, std::size_t size, std::int64_t value)
+	{ return countKernel<SSE2Int64>(data, size, value); }
+
+	std::int32_t SSE2Kernels::min(const std::int32_t* data, std::size_t size)
+	{ return minKernel<SSE2Int32>(data, size); }
+	float SSE2Kernels::min(const float* data, std::size_t size)
+	{ return minKernel<SSE2Float>(data, size); }
+	double SSE2Kernels::min(const double* data, std::size_t size)
+	{ return minKernel<SSE2Double>(data, size); }
+
+	std::int32_t SSE2Kernels::max(const std::int32_t* data, std::size_t size)
+	{ return maxKernel<SSE2Int32>(data, size); }
+	float SSE2Kernels::max(const float* data, std::size_t size)
+	{ return maxKernel<SSE2Float>(data, size); }
+	double SSE2Kernels::max(const double* data, std::size_t size)
+	{ return maxKernel<SSE2Double>(data, size); }
+
+	std::int64_t SSE2Kernels::sum(const std::int32_t* data, std::size_t size)
+	{ return sumKernel<SSE2Int32>(data, size); }
+	float SSE2Kernels::sum(const float* data, std::size_t size)
+	{ return sumKernel<SSE2Float>(data, size); }
+	double SSE2Kernels::sum(const double* data, std::size_t size)
+	{ return sumKernel<SSE2Double>(data, size); }
+
+}
+
+#endif		// STDEXT_SIMD_X86
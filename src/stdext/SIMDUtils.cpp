@@ -0,0 +1,172 @@
+#include "SIMDKernels.h"
+
+#ifdef STDEXT_SIMD_X86
+	#ifdef _MSC_VER
+		#include <intrin.h>
+		#include <immintrin.h>
+	#endif
+#endif
+
+namespace stdext {
+
+	namespace {
+
+		SIMDLevel detectSIMDLevel()
+		{
+#if defined(STDEXT_SIMD_X86) && (defined(__GNUC__) || defined(__clang__))
+			__builtin_cpu_init();
+			if (__builtin_cpu_supports("avx2")) {
+				return SIMDLevel::AVX2;
+			}
+			if (__builtin_cpu_supports("sse2")) {
+				return SIMDLevel::SSE2;
+			}
+#elif defined(STDEXT_SIMD_X86) && defined(_MSC_VER)
+			int info[4];
+			__cpuid(info, 0);
+			int numIds = info[0];
+
+			__cpuid(info, 1);
+			bool sse2 = (info[3] & (1 << 26)) != 0;
+			bool osxsave = (info[2] & (1 << 27)) != 0;
+			bool avx = (info[2] & (1 << 28)) != 0;
+
+			// The OS must also save the AVX registers
+			if ((numIds >= 7) && osxsave && avx && ((_xgetbv(0) & 0x6) == 0x6)) {
+				__cpuidex(info, 7, 0);
+				if (info[1] & (1 << 5)) {
+					return SIMDLevel::AVX2;
+				}
+			}
+			if (sse2) {
+				return SIMDLevel::SSE2;
+			}
+#endif
+			return SIMDLevel::Scalar;
+		}
+
+
+		template <typename T>
+		std::size_t dispatchFind(const T* data, std::size_t size, T value)
+		{
+			switch (getSIMDLevel()) {
+#ifdef STDEXT_SIMD_X86
+				case SIMDLevel::AVX2:	return AVX2Kernels::find(data, size, value);
+				case SIMDLevel::SSE2:	return SSE2Kernels::find(data, size, value);
+#endif
+				default:				return scalarFind(data, size, value);
+			}
+		}
+
+
+		template <typename T>
+		std::size_t dispatchCount(const T* data, std::size_t size, T value)
+		{
+			switch (getSIMDLevel()) {
+#ifdef STDEXT_SIMD_X86
+				case SIMDLevel::AVX2:	return AVX2Kernels::count(data, size, value);
+				case SIMDLevel::SSE2:	return SSE2Kernels::count(data, size, value);
+#endif
+				default:				return scalarCount(data, size, value);
+			}
+		}
+
+
+		template <typename T>
+		T dispatchMin(const T* data, std::size_t size)
+		{
+			switch (getSIMDLevel()) {
+#ifdef STDEXT_SIMD_X86
+				case SIMDLevel::AVX2:	return AVX2Kernels::min(data, size);
+				case SIMDLevel::SSE2:	return SSE2Kernels::min(data, size);
+#endif
+				default:				return scalarMin(data, size);
+			}
+		}
+
+
+		template <typename T>
+		T dispatchMax(const T* data, std::size_t size)
+		{
+			switch (getSIMDLevel()) {
+#ifdef STDEXT_SIMD_X86
+				case SIMDLevel::AVX2:	return AVX2Kernels::max(data, size);
+				case SIMDLevel::SSE2:	return SSE2Kernels::max(data, size);
+#endif
+				default:				return scalarMax(data, size);
+			}
+		}
+
+
+		template <typename T>
+		SumType<T> dispatchSum(const T* data, std::size_t size)
+		{
+			switch (getSIMDLevel()) {
+#ifdef STDEXT_SIMD_X86
+				case SIMDLevel::AVX2:	return AVX2Kernels::sum(data, size);
+				case SIMDLevel::SSE2:	return SSE2Kernels::sum(data, size);
+#endif
+				default:				return scalarSum(data, size);
+			}
+		}
+
+	}
+
+
+	SIMDLevel getSIMDLevel()
+	{
+		static const SIMDLevel level = detectSIMDLevel();
+		return level;
+	}
+
+
+	std::size_t simdFind(const std::int32_t* data, std::size_t size, std::int32_t value)
+	{ return dispatchFind(data, size, value); }
+	std::size_t simdFind(const float* data, std::size_t size, float value)
+	{ return dispatchFind(data, size, value); }
+	std::size_t simdFind(const double* data, std::size_t size, double value)
+	{ return dispatchFind(data, size, value); }
+	std::size_t simdFind(const std::int64_t* data, std::size_t size, std::int64_t value)
+	{ return dispatchFind(data, size, value); }
+
+	// The unsigned elements are compared bitwise with the signed kernels
+	std::size_t simdFind(const std::uint32_t* data, std::size_t size, std::uint32_t value)
+	{ return dispatchFind(reinterpret_cast<const std::int32_t*>(data), size, static_cast<std::int32_t>(value)); }
+	std::size_t simdFind(const std::uint64_t* data, std::size_t size, std::uint64_t value)
+	{ return dispatchFind(reinterpret_cast<const std::int64_t*>(data), size, static_cast<std::int64_t>(value)); }
+
+	std::size_t simdCount(const std::int32_t* data, std::size_t size, std::int32_t value)
+	{ return dispatchCount(data, size, value); }
+	std::size_t simdCount(const float* data, std::size_t size, float value)
+	{ return dispatchCount(data, size, value); }
+	std::size_t simdCount(const double* data, std::size_t size, double value)
+	{ return dispatchCount(data, size, value); }
+	std::size_t simdCount(const std::int64_t* data, std::size_t size, std::int64_t value)
+	{ return dispatchCount(data, size, value); }
+	std::size_t simdCount(const std::uint32_t* data, std::size_t size, std::uint32_t value)
+	{ return dispatchCount(reinterpret_cast<const std::int32_t*>(data), size, static_cast<std::int32_t>(value)); }
+	std::size_t simdCount(const std::uint64_t* data, std::size_t size, std::uint64_t value)
+	{ return dispatchCount(reinterpret_cast<const std::int64_t*>(data), size, static_cast<std::int64_t>(value)); }
+
+	std::int32_t simdMin(const std::int32_t* data, std::size_t size)
+	{ return dispatchMin(data, size); }
+	float simdMin(const float* data, std::size_t size)
+	{ return dispatchMin(data, size); }
+	double simdMin(const double* data, std::size_t size)
+	{ return dispatchMin(data, size); }
+
+	std::int32_t simdMax(const std::int32_t* data, std::size_t size)
+	{ return dispatchMax(data, size); }
+	float simdMax(const float* data, std::size_t size)
+	{ return dispatchMax(data, size); }
+	double simdMax(const double* data, std::size_t size)
+	{ return dispatchMax(data, size); }
+
+	std::int64_t simdSum(const std::int32_t* data, std::size_t size)
+	{ return dispatchSum(data, size); }
+	float simdSum(const float* data, std::size_t size)
+	{ return dispatchSum(data, size); }
+	double simdSum(const double* data, std::size_t size)
+	{ return dispatchSum(data, size); }
+
+}
@@ -2,6 +2,15 @@
 
 namespace stdext {
 
+	namespace {
+
+		/** The ThreadPool that owns the current thread, nullptr if it isn't
+		 * an execution thread of any ThreadPool */
+		thread_local const ThreadPool* tCurrentPool = nullptr;
+
+	}
+
+
 	ThreadPool::ThreadPool(std::size_t numThreads) :
 		mThreads(nullptr), mNumThreads(numThreads), mStop(false)
 	{
@@ -28,8 +37,16 @@ namespace stdext {
 	}
 
 
+	bool ThreadPool::isPoolThread() const
+	{
+		return tCurrentPool == this;
+	}
+
+
 	void ThreadPool::thRun()
 	{
+		tCurrentPool = this;
+
 		std::unique_lock<std::mutex> lock(mMutex);
 		while (!mStop) {
 			if (mTasksQueue.empty()) {